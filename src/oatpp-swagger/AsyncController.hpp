@@ -25,6 +25,9 @@
 #ifndef oatpp_swagger_AsyncController_hpp
 #define oatpp_swagger_AsyncController_hpp
 
+#include "oatpp-swagger/DocumentAggregator.hpp"
+#include "oatpp-swagger/DocumentGroups.hpp"
+#include "oatpp-swagger/DocumentPublisher.hpp"
 #include "oatpp-swagger/Resources.hpp"
 #include "oatpp-swagger/oas3/Generator.hpp"
 
@@ -35,6 +38,9 @@
 #include "oatpp/core/macro/codegen.hpp"
 #include "oatpp/core/macro/component.hpp"
 
+#include <chrono>
+#include <future>
+
 namespace oatpp { namespace swagger {
 
 /**
@@ -43,7 +49,13 @@ namespace oatpp { namespace swagger {
  * For more information about integrating swagger-ui in oatpp application see [oatpp-swagger module](/docs/modules/oatpp-swagger/). <br>
  * Exposed endpoints:
  * <ul>
- *   <li>&id:ENDPOINT_ASYNC;("GET", "/api-docs/oas-3.0.0.json", Api) - Server Open API Specification.</li>
+ *   <li>&id:ENDPOINT_ASYNC;("GET", "/api-docs/oas-3.0.0.json", Api) - Server Open API Specification.
+ *   Use `?tags=tag1,tag2` query to get sub-document with operations of the given tags only.
+ *   Renderings which are not cached yet are created off the executor thread (see &id:oatpp::swagger::DocumentCache::renderTaggedJsonAsync;).</li>
+ *   <li>&id:ENDPOINT_ASYNC;("GET", "/api-docs/oas-3.0.0.yaml", ApiYaml) - Server Open API Specification in YAML format.</li>
+ *   <li>&id:ENDPOINT_ASYNC;("GET", "/api-docs/oas-3.0.0-lite.json", ApiLite) - Server Open API Specification without free-text fields.</li>
+ *   <li>&id:ENDPOINT_ASYNC;("GET", "/api-docs/{filename}", ApiGroup) - Open API Specification of the &id:oatpp::swagger::DocumentGroups; group
+ *   as `{group}.json` or `{group}.yaml`.</li>
  *   <li>&id:ENDPOINT_ASYNC;("GET", "/swagger/ui", GetUIRoot) - Server Swagger-UI. (index.html).</li>
  *   <li>&id:ENDPOINT_ASYNC;("GET", "/swagger/{filename}", GetUIResource) - Serve Swagger-UI resources.</li>
  * </ul>
@@ -52,16 +64,42 @@ class AsyncController : public oatpp::web::server::api::ApiController {
 public:
   typedef AsyncController __ControllerType;
 public:
-  oas3::Document::ObjectWrapper m_document;
+  std::shared_ptr<DocumentPublisher> m_documentPublisher;
   std::shared_ptr<oatpp::swagger::Resources> m_resources;
+  std::shared_ptr<DocumentGroups> m_documentGroups;
+  oatpp::String m_indexHtml;
 public:
   AsyncController(const std::shared_ptr<ObjectMapper>& objectMapper,
-             const oas3::Document::ObjectWrapper& document,
+             const std::shared_ptr<DocumentPublisher>& documentPublisher,
              const std::shared_ptr<oatpp::swagger::Resources>& resources)
     : oatpp::web::server::api::ApiController(objectMapper)
-    , m_document(document)
+    , m_documentPublisher(documentPublisher)
     , m_resources(resources)
   {}
+
+  AsyncController(const std::shared_ptr<ObjectMapper>& objectMapper,
+             const std::shared_ptr<DocumentGroups>& documentGroups,
+             const std::shared_ptr<oatpp::swagger::Resources>& resources)
+    : oatpp::web::server::api::ApiController(objectMapper)
+    , m_resources(resources)
+    , m_documentGroups(documentGroups)
+  {
+    OATPP_ASSERT(!documentGroups->getGroupNames().empty() && "[oatpp::swagger::AsyncController::AsyncController()]: Error. No document groups.");
+    m_documentPublisher = documentGroups->getGroup(documentGroups->getGroupNames().front());
+    m_indexHtml = documentGroups->rewriteIndexHtml(resources->readResource("index.html"));
+  }
+
+  AsyncController(const std::shared_ptr<ObjectMapper>& objectMapper,
+             const std::shared_ptr<DocumentCache>& documentCache,
+             const std::shared_ptr<oatpp::swagger::Resources>& resources)
+    : AsyncController(objectMapper, DocumentPublisher::createShared(objectMapper, nullptr, ControllerConfig::createShared(), documentCache), resources)
+  {}
+
+  AsyncController(const std::shared_ptr<ObjectMapper>& objectMapper,
+             const oas3::Document::ObjectWrapper& document,
+             const std::shared_ptr<oatpp::swagger::Resources>& resources)
+    : AsyncController(objectMapper, DocumentCache::createShared(objectMapper, document, ControllerConfig::createShared()), resources)
+  {}
 public:
 
   /**
@@ -69,11 +107,13 @@ public:
    * @param endpointsList - &id:oatpp::web::server::api::ApiController::Endpoints;
    * @param documentInfo - &id:oatpp::swagger::DocumentInfo;.
    * @param resources - &id:oatpp::swagger::Resources;.
+   * @param config - &id:oatpp::swagger::ControllerConfig;.
    * @return - AsyncController.
    */
   static std::shared_ptr<AsyncController> createShared(const std::shared_ptr<Endpoints>& endpointsList,
                                                        OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::DocumentInfo>, documentInfo),
-                                                       OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::Resources>, resources)){
+                                                       OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::Resources>, resources),
+                                                       const std::shared_ptr<ControllerConfig>& config = ControllerConfig::createShared()){
     
     auto serializerConfig = oatpp::parser::json::mapping::Serializer::Config::createShared();
     serializerConfig->includeNullFields = false;
@@ -83,9 +123,98 @@ public:
     
     auto objectMapper = oatpp::parser::json::mapping::ObjectMapper::createShared(serializerConfig, deserializerConfig);
     
-    auto document = oas3::Generator::generateDocument(documentInfo, endpointsList);
+    auto documentPublisher = DocumentPublisher::createShared(objectMapper, documentInfo, config, nullptr);
+    if(config && config->deferGeneration) {
+      documentPublisher->generateInBackground(endpointsList);
+    } else {
+      documentPublisher->regenerate(endpointsList);
+    }
     
-    return std::make_shared<AsyncController>(objectMapper, document, resources);
+    return std::make_shared<AsyncController>(objectMapper, documentPublisher, resources);
+  }
+
+  /**
+   * Create shared AsyncController serving documents of several endpoint groups. <br>
+   * The first group is served at the default `/api-docs/oas-3.0.0.json` location as well.
+   * @param documentGroups - &id:oatpp::swagger::DocumentGroups;.
+   * @param resources - &id:oatpp::swagger::Resources;.
+   * @return - AsyncController.
+   */
+  static std::shared_ptr<AsyncController> createShared(const std::shared_ptr<DocumentGroups>& documentGroups,
+                                                       OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::Resources>, resources)) {
+    return std::make_shared<AsyncController>(documentGroups->getObjectMapper(), documentGroups, resources);
+  }
+
+  /**
+   * Create shared AsyncController serving the combined document of several services.
+   * Document is available after the first &id:oatpp::swagger::DocumentAggregator::refresh;.
+   * @param documentAggregator - &id:oatpp::swagger::DocumentAggregator;.
+   * @param resources - &id:oatpp::swagger::Resources;.
+   * @return - AsyncController.
+   */
+  static std::shared_ptr<AsyncController> createShared(const std::shared_ptr<DocumentAggregator>& documentAggregator,
+                                                       OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::Resources>, resources)) {
+    return std::make_shared<AsyncController>(documentAggregator->getObjectMapper(), documentAggregator->getPublisher(), resources);
+  }
+
+  /**
+   * Get &id:oatpp::swagger::DocumentGroups; served by this controller.
+   * @return - `std::shared_ptr` to &id:oatpp::swagger::DocumentGroups;. `nullptr` if controller serves a single document.
+   */
+  std::shared_ptr<DocumentGroups> getDocumentGroups() const {
+    return m_documentGroups;
+  }
+
+  /**
+   * Get &id:oatpp::swagger::DocumentCache; currently served by this controller.
+   * @return - `std::shared_ptr` to &id:oatpp::swagger::DocumentCache;. `nullptr` if deferred document is not generated yet.
+   */
+  std::shared_ptr<DocumentCache> getDocumentCache() const {
+    return m_documentPublisher->getDocumentCache();
+  }
+
+  /**
+   * Get &id:oatpp::swagger::DocumentPublisher; of this controller.
+   * @return - `std::shared_ptr` to &id:oatpp::swagger::DocumentPublisher;.
+   */
+  std::shared_ptr<DocumentPublisher> getDocumentPublisher() const {
+    return m_documentPublisher;
+  }
+
+  /**
+   * Regenerate document for the updated list of endpoints. <br>
+   * Requests in flight keep being served from the previous document. See &id:oatpp::swagger::DocumentPublisher::regenerate;.
+   * @param endpointsList - &id:oatpp::web::server::api::ApiController::Endpoints;
+   * @return - `true` if the document was generated by this call, `false` if the request was coalesced into a running pass.
+   */
+  bool regenerate(const std::shared_ptr<Endpoints>& endpointsList) {
+    return m_documentPublisher->regenerate(endpointsList);
+  }
+
+  /**
+   * Add endpoints of a newly added controller to the document. Only the new endpoints are generated. <br>
+   * See &id:oatpp::swagger::DocumentPublisher::extend;.
+   * @param endpointsList - &id:oatpp::web::server::api::ApiController::Endpoints;
+   * @return - `true` if document was extended. `false` if there is no document yet or it is not kept.
+   */
+  bool extend(const std::shared_ptr<Endpoints>& endpointsList) {
+    return m_documentPublisher->extend(endpointsList);
+  }
+
+  /**
+   * Check if document is generated and served. Always `true` unless &id:oatpp::swagger::ControllerConfig::deferGeneration; is set.
+   * @return - `true` if document is ready.
+   */
+  bool isDocumentReady() const {
+    return m_documentPublisher->isReady();
+  }
+
+  /**
+   * Get state of the document - pending, ready or failed. See &id:oatpp::swagger::DocumentPublisher::getState;.
+   * @return - &id:oatpp::swagger::DocumentPublisher::State;.
+   */
+  DocumentPublisher::State getDocumentState() const {
+    return m_documentPublisher->getState();
   }
   
 #include OATPP_CODEGEN_BEGIN(ApiController)
@@ -94,8 +223,96 @@ public:
     
     ENDPOINT_ASYNC_INIT(Api)
     
+    std::shared_future<std::shared_ptr<Representation>> m_tagged;
+    
+    Action act() override {
+      auto documentCache = controller->getDocumentCache();
+      if(!documentCache) {
+        return _return(controller->m_documentPublisher->createNotReadyResponse());
+      }
+      auto tags = request->getQueryParameter("tags");
+      if(tags) {
+        OATPP_ASSERT_HTTP(documentCache->getDocument(), Status::CODE_404, "Tag filtering requires ControllerConfig::keepDocument")
+        auto tagged = documentCache->findTaggedJson(tags);
+        if(tagged) {
+          return _return(tagged->createResponse(request->getHeader("Accept-Encoding"),
+                                                request->getHeader("If-None-Match")));
+        }
+        // cache miss - filter, serialize and compress on a separate thread, not on the executor
+        m_tagged = documentCache->renderTaggedJsonAsync(tags);
+        return yieldTo(&Api::onTagged);
+      }
+      return _return(documentCache->createJsonResponse(request->getHeader("Accept-Encoding"),
+                                                       request->getHeader("If-None-Match")));
+    }
+    
+    Action onTagged() {
+      if(m_tagged.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        return waitRepeat(std::chrono::milliseconds(1));
+      }
+      return _return(m_tagged.get()->createResponse(request->getHeader("Accept-Encoding"),
+                                                    request->getHeader("If-None-Match")));
+    }
+    
+  };
+
+  ENDPOINT_ASYNC("GET", "/api-docs/oas-3.0.0.yaml", ApiYaml) {
+    
+    ENDPOINT_ASYNC_INIT(ApiYaml)
+    
     Action act() override {
-      return _return(controller->createDtoResponse(Status::CODE_200, controller->m_document));
+      auto documentCache = controller->getDocumentCache();
+      if(!documentCache) {
+        return _return(controller->m_documentPublisher->createNotReadyResponse());
+      }
+      auto yaml = documentCache->getYaml();
+      OATPP_ASSERT_HTTP(yaml, Status::CODE_404, "YAML rendering is disabled")
+      return _return(yaml->createResponse(request->getHeader("Accept-Encoding"),
+                                          request->getHeader("If-None-Match")));
+    }
+    
+  };
+
+  ENDPOINT_ASYNC("GET", "/api-docs/oas-3.0.0-lite.json", ApiLite) {
+    
+    ENDPOINT_ASYNC_INIT(ApiLite)
+    
+    Action act() override {
+      auto documentCache = controller->getDocumentCache();
+      if(!documentCache) {
+        return _return(controller->m_documentPublisher->createNotReadyResponse());
+      }
+      auto lite = documentCache->getLiteJson();
+      OATPP_ASSERT_HTTP(lite, Status::CODE_404, "Lite rendering is disabled")
+      return _return(lite->createResponse(request->getHeader("Accept-Encoding"),
+                                          request->getHeader("If-None-Match")));
+    }
+    
+  };
+  
+  // declared after the fixed /api-docs/ endpoints so that they are matched first
+  ENDPOINT_ASYNC("GET", "/api-docs/{filename}", ApiGroup) {
+    
+    ENDPOINT_ASYNC_INIT(ApiGroup)
+    
+    Action act() override {
+      OATPP_ASSERT_HTTP(controller->m_documentGroups, Status::CODE_404, "Document groups are not configured")
+      auto filename = request->getPathVariable("filename");
+      auto jsonGroup = DocumentGroups::getGroupName(filename, ".json");
+      auto publisher = controller->m_documentGroups->getGroup(jsonGroup ? jsonGroup : DocumentGroups::getGroupName(filename, ".yaml"));
+      OATPP_ASSERT_HTTP(publisher, Status::CODE_404, "Unknown document group")
+      auto documentCache = publisher->getDocumentCache();
+      if(!documentCache) {
+        return _return(publisher->createNotReadyResponse());
+      }
+      if(jsonGroup) {
+        return _return(documentCache->createJsonResponse(request->getHeader("Accept-Encoding"),
+                                                         request->getHeader("If-None-Match")));
+      }
+      auto yaml = documentCache->getYaml();
+      OATPP_ASSERT_HTTP(yaml, Status::CODE_404, "YAML rendering is disabled")
+      return _return(yaml->createResponse(request->getHeader("Accept-Encoding"),
+                                          request->getHeader("If-None-Match")));
     }
     
   };
@@ -105,6 +322,9 @@ public:
     ENDPOINT_ASYNC_INIT(GetUIRoot)
     
     Action act() override {
+      if(controller->m_indexHtml) {
+        return _return(controller->createResponse(Status::CODE_200, controller->m_indexHtml));
+      }
       return _return(controller->createResponse(Status::CODE_200, controller->m_resources->getResource("index.html")));
     }
     
@@ -0,0 +1,191 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "Compression.hpp"
+
+#include <cstring>
+#include <vector>
+
+#ifdef OATPP_SWAGGER_ZLIB
+#include <zlib.h>
+#endif
+
+namespace oatpp { namespace swagger {
+
+const char* const Compression::ENCODING_GZIP = "gzip";
+const char* const Compression::ENCODING_DEFLATE = "deflate";
+const char* const Compression::ENCODING_IDENTITY = "identity";
+
+namespace {
+
+#ifdef OATPP_SWAGGER_ZLIB
+
+  oatpp::String compress(const oatpp::String& data, v_int32 level, int windowBits) {
+
+    z_stream stream;
+    std::memset(&stream, 0, sizeof(stream));
+
+    if(deflateInit2(&stream, level, Z_DEFLATED, windowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+      return nullptr;
+    }
+
+    std::vector<Bytef> buffer(deflateBound(&stream, (uLong) data->getSize()));
+
+    stream.next_in = (Bytef*) data->getData();
+    stream.avail_in = (uInt) data->getSize();
+    stream.next_out = buffer.data();
+    stream.avail_out = (uInt) buffer.size();
+
+    auto res = ::deflate(&stream, Z_FINISH);
+    auto size = stream.total_out;
+    deflateEnd(&stream);
+
+    if(res != Z_STREAM_END) {
+      return nullptr;
+    }
+
+    return oatpp::String((const char*) buffer.data(), (v_buff_size) size, true);
+
+  }
+
+#endif
+
+  bool isSpace(v_char8 c) {
+    return c == ' ' || c == '\t';
+  }
+
+  bool isDigit(v_char8 c) {
+    return c >= '0' && c <= '9';
+  }
+
+  /*
+   * Parse qvalue - "0", "0.5", "1.000" (RFC 7231, section 5.3.1). Parsed by hand because strtod() expects
+   * the decimal point of the current locale. Digits after the third decimal are ignored, malformed value is `0`.
+   */
+  v_float64 parseQuality(const char* data, v_buff_size size) {
+
+    if(size < 1 || (data[0] != '0' && data[0] != '1')) {
+      return 0;
+    }
+
+    v_int32 thousandths = (data[0] - '0') * 1000;
+
+    if(size > 1 && data[1] == '.') {
+      v_int32 scale = 100;
+      for(v_buff_size i = 2; i < size && isDigit(data[i]); i ++) {
+        thousandths += (data[i] - '0') * scale;
+        scale /= 10;
+      }
+    }
+
+    return thousandths > 1000 ? 1.0 : thousandths / 1000.0;
+
+  }
+
+}
+
+bool Compression::isAvailable() {
+#ifdef OATPP_SWAGGER_ZLIB
+  return true;
+#else
+  return false;
+#endif
+}
+
+oatpp::String Compression::gzip(const oatpp::String& data, v_int32 level) {
+#ifdef OATPP_SWAGGER_ZLIB
+  return compress(data, level, 15 + 16);
+#else
+  (void) data;
+  (void) level;
+  return nullptr;
+#endif
+}
+
+oatpp::String Compression::deflate(const oatpp::String& data, v_int32 level) {
+#ifdef OATPP_SWAGGER_ZLIB
+  return compress(data, level, 15);
+#else
+  (void) data;
+  (void) level;
+  return nullptr;
+#endif
+}
+
+v_float64 Compression::getQuality(const oatpp::String& acceptEncoding, const char* encoding) {
+
+  bool isIdentity = std::strcmp(encoding, ENCODING_IDENTITY) == 0;
+
+  if(!acceptEncoding) {
+    return isIdentity ? 1.0 : 0.0;
+  }
+
+  v_float64 explicitQuality = -1;
+  v_float64 anyQuality = -1;
+
+  const char* data = acceptEncoding->c_str();
+  v_buff_size size = acceptEncoding->getSize();
+  v_buff_size encodingSize = std::strlen(encoding);
+
+  v_buff_size pos = 0;
+  while(pos < size) {
+
+    while(pos < size && (isSpace(data[pos]) || data[pos] == ',')) pos ++;
+
+    v_buff_size tokenStart = pos;
+    while(pos < size && data[pos] != ',' && data[pos] != ';' && !isSpace(data[pos])) pos ++;
+    v_buff_size tokenSize = pos - tokenStart;
+
+    v_float64 quality = 1.0;
+    while(pos < size && data[pos] != ',') {
+      if(data[pos] == ';') {
+        pos ++;
+        while(pos < size && isSpace(data[pos])) pos ++;
+        if(pos + 1 < size && (data[pos] == 'q' || data[pos] == 'Q') && data[pos + 1] == '=') {
+          quality = parseQuality(data + pos + 2, size - pos - 2);
+        }
+      } else {
+        pos ++;
+      }
+    }
+
+    if(tokenSize == 1 && data[tokenStart] == '*') {
+      anyQuality = quality;
+    } else if(tokenSize == encodingSize && oatpp::base::StrBuffer::equalsCI(data + tokenStart, encoding, tokenSize)) {
+      explicitQuality = quality;
+    }
+
+  }
+
+  if(explicitQuality >= 0) {
+    return explicitQuality;
+  }
+  if(anyQuality >= 0) {
+    return anyQuality;
+  }
+  return isIdentity ? 1.0 : 0.0;
+
+}
+
+}}
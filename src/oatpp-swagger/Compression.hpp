@@ -0,0 +1,91 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_swagger_Compression_hpp
+#define oatpp_swagger_Compression_hpp
+
+#include "oatpp/core/Types.hpp"
+
+namespace oatpp { namespace swagger {
+
+/**
+ * Content codings used to precompress served documents. <br>
+ * Compression is backed by zlib. If module was built without zlib then &l:Compression::isAvailable (); returns `false`
+ * and documents are served with `identity` coding only.
+ */
+class Compression {
+public:
+
+  /**
+   * `gzip` content coding.
+   */
+  static const char* const ENCODING_GZIP;
+
+  /**
+   * `deflate` content coding.
+   */
+  static const char* const ENCODING_DEFLATE;
+
+  /**
+   * `identity` content coding.
+   */
+  static const char* const ENCODING_IDENTITY;
+
+public:
+
+  /**
+   * Check if module was built with compression support.
+   * @return - `true` if compression is available.
+   */
+  static bool isAvailable();
+
+  /**
+   * Compress data to `gzip` format.
+   * @param data - data to compress.
+   * @param level - compression level `[0..9]`.
+   * @return - compressed data or `nullptr` if compression is not available.
+   */
+  static oatpp::String gzip(const oatpp::String& data, v_int32 level);
+
+  /**
+   * Compress data to `deflate` (zlib) format.
+   * @param data - data to compress.
+   * @param level - compression level `[0..9]`.
+   * @return - compressed data or `nullptr` if compression is not available.
+   */
+  static oatpp::String deflate(const oatpp::String& data, v_int32 level);
+
+  /**
+   * Get quality value which `Accept-Encoding` header assigns to the content coding.
+   * @param acceptEncoding - value of `Accept-Encoding` header. May be `nullptr`.
+   * @param encoding - content coding.
+   * @return - quality value in range `[0..1]`. `0` means content coding is not acceptable.
+   */
+  static v_float64 getQuality(const oatpp::String& acceptEncoding, const char* encoding);
+
+};
+
+}}
+
+#endif /* oatpp_swagger_Compression_hpp */
@@ -0,0 +1,187 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_swagger_ControllerConfig_hpp
+#define oatpp_swagger_ControllerConfig_hpp
+
+#include "oatpp-swagger/oas3/Generator.hpp"
+
+#include "oatpp/core/Types.hpp"
+
+namespace oatpp { namespace swagger {
+
+/**
+ * Configuration of &id:oatpp::swagger::Controller; and &id:oatpp::swagger::AsyncController;.
+ */
+class ControllerConfig {
+public:
+
+  /**
+   * Create shared ControllerConfig.
+   * @return - 'std::shared_ptr' to ControllerConfig.
+   */
+  static std::shared_ptr<ControllerConfig> createShared() {
+    return std::make_shared<ControllerConfig>();
+  }
+
+  /**
+   * Keep &id:oatpp::swagger::oas3::Document; in memory once it was serialized. <br>
+   * Set to `false` to release the DTO tree and keep serialized bytes only.
+   */
+  bool keepDocument = true;
+
+  /**
+   * Generate document on a background thread instead of blocking `createShared()`. <br>
+   * Until the document is ready, document endpoints respond with `503 Service Unavailable` and `Retry-After` header.
+   * If generation fails they respond with `500 Internal Server Error`. See &id:oatpp::swagger::DocumentPublisher::getState;.
+   */
+  bool deferGeneration = false;
+
+  /**
+   * Number of threads used to generate the document. Generated document does not depend on this value. <br>
+   * `1` - generate on the calling thread only. See &id:oatpp::swagger::oas3::Generator::generateDocument;.
+   */
+  v_int32 generatorThreads = 1;
+
+  /**
+   * &id:oatpp::swagger::oas3::Generator; used to generate the document. <br>
+   * Set it to reuse generator with custom schema mappers (see &id:oatpp::swagger::oas3::Generator::registerSchemaMapper;).
+   * `nullptr` - controller creates its own generator.
+   */
+  std::shared_ptr<oas3::Generator> generator;
+
+  /**
+   * Allocate objects of the generated document from a monotonic arena (see &id:oatpp::swagger::oas3::Generator::setUseArena;). <br>
+   * Reduces allocation cost of large documents. The generator set in &l:ControllerConfig::generator; is not modified -
+   * if arena allocation is not enabled on it, its private copy is used (see &id:oatpp::swagger::DocumentPublisher::createGenerator;).
+   */
+  bool arenaAllocation = false;
+
+  /**
+   * Hoist repeated inline schemas and responses of the generated document into `components` and reference them by `$ref`
+   * (see &id:oatpp::swagger::oas3::Generator::setDeduplicate;). <br>
+   * Makes documents of large APIs with many similar endpoints smaller. The generator set in &l:ControllerConfig::generator; is not modified -
+   * if deduplication is not enabled on it, its private copy is used (see &id:oatpp::swagger::DocumentPublisher::createGenerator;).
+   */
+  bool deduplicateComponents = false;
+
+  /**
+   * Order of paths and `components/schemas` in the generated document (see &id:oatpp::swagger::oas3::Generator::setOrder;). <br>
+   * &l:ControllerConfig::ORDER_REGISTRATION;id:oatpp::swagger::oas3::Generator::ORDER_REGISTRATION; keeps the order of the generator set in &l:ControllerConfig::generator;.
+   * Other orders are applied to its private copy, the generator itself is not modified
+   * (see &id:oatpp::swagger::DocumentPublisher::createGenerator;).
+   */
+  oas3::Generator::Order documentOrder = oas3::Generator::ORDER_REGISTRATION;
+
+  /**
+   * Directory to keep on-disk snapshot of the generated document in (see &id:oatpp::swagger::DocumentSnapshot;). <br>
+   * On generation the snapshot is loaded instead of generating the document if fingerprint of the endpoints
+   * and &id:oatpp::swagger::DocumentInfo; matches (see &id:oatpp::swagger::oas3::Generator::computeFingerprint;).
+   * Otherwise document is generated and the snapshot is replaced. <br>
+   * `nullptr` - snapshots are disabled.
+   */
+  oatpp::String snapshotDir;
+
+  /**
+   * Value in seconds of `Retry-After` header sent while the deferred document is not ready yet.
+   */
+  v_int32 retryAfter = 1;
+
+  /**
+   * Stream JSON document path by path and component by component instead of serving pre-serialized bytes. <br>
+   * Streamed document is not compressed. It is sent with &l:ControllerConfig::cacheControl; and, when generated by the controller,
+   * with `ETag` derived from the fingerprint of document inputs (see &id:oatpp::swagger::oas3::Generator::computeFingerprint;).
+   * Document is always kept in memory in this mode regardless of &l:ControllerConfig::keepDocument;. <br>
+   * Only the JSON document is streamed - YAML (&l:ControllerConfig::enableYaml;) and lite (&l:ControllerConfig::enableLite;)
+   * renderings are still pre-serialized together with the document.
+   */
+  bool streamDocument = false;
+
+  /**
+   * Approximate upper bound of memory buffered by each document stream when &l:ControllerConfig::streamDocument; is `true`. <br>
+   * This is a soft bound: the stream serializes one path item or schema at a time, so a single path item or schema
+   * larger than this size is buffered whole.
+   */
+  v_buff_size streamBufferSize = 16 * 1024;
+
+  /**
+   * Serialize JSON renderings with &id:oatpp::swagger::oas3::JsonWriter; instead of the object mapper. <br>
+   * JsonWriter writes the oas3 model directly without runtime reflection. Its output is identical to the one of the JSON object mapper
+   * with `includeNullFields = false` (the object mapper of &id:oatpp::swagger::Controller::createShared;),
+   * so keep it `false` if the controller is given a differently configured object mapper.
+   */
+  bool useJsonWriter = false;
+
+  /**
+   * Render YAML version of the document served at `/api-docs/oas-3.0.0.yaml`.
+   */
+  bool enableYaml = true;
+
+  /**
+   * Render "lite" version of the document served at `/api-docs/oas-3.0.0-lite.json`. <br>
+   * Lite document has all free-text fields left out. See &id:oatpp::swagger::oas3::DocumentFilter::createLiteDocument;.
+   */
+  bool enableLite = true;
+
+  /**
+   * Maximum number of tag-filtered renderings (`/api-docs/oas-3.0.0.json?tags=...`) kept in memory. <br>
+   * Least recently used rendering is dropped first. `0` - renderings are not cached.
+   */
+  v_int32 taggedDocumentCacheSize = 16;
+
+  /**
+   * Maximum number of distinct tags in the `tags` query of a tag-filtered rendering. <br>
+   * Tags which are not used by any operation of the document are ignored and don't count.
+   * Requests with more tags are rejected with `400 Bad Request`.
+   */
+  v_int32 maxFilterTags = 8;
+
+  /**
+   * Build precompressed `gzip` and `deflate` variants of served documents. <br>
+   * Variants are built once, when the document is published, so requests never wait for compression. <br>
+   * Has no effect if module was built without zlib. See &id:oatpp::swagger::Compression::isAvailable;.
+   */
+  bool enableCompression = true;
+
+  /**
+   * Minimal size in bytes of the serialized document for compressed variants to be built.
+   */
+  v_buff_size compressionThreshold = 1024;
+
+  /**
+   * Compression level `[0..9]`. Variants are built only once so best compression is used by default.
+   */
+  v_int32 compressionLevel = 9;
+
+  /**
+   * Value of `Cache-Control` header sent along with the document and its `ETag`. <br>
+   * Set to `nullptr` to omit the header.
+   */
+  oatpp::String cacheControl = "no-cache";
+
+};
+
+}}
+
+#endif /* oatpp_swagger_ControllerConfig_hpp */
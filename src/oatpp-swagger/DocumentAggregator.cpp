@@ -0,0 +1,571 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "DocumentAggregator.hpp"
+
+#include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <unordered_set>
+
+namespace oatpp { namespace swagger {
+
+namespace {
+
+  template <class Value>
+  using Fields = DocumentAggregator::Fields<Value>;
+
+  template <class Value>
+  using List = oatpp::data::mapping::type::List<Value>;
+
+  typedef Fields<List<String>::ObjectWrapper> SecurityRequirement;
+
+  const char* const SCHEMA_REF_PREFIX = "#/components/schemas/";
+  const char* const RESPONSE_REF_PREFIX = "#/components/responses/";
+
+  bool hasPrefix(const oatpp::String& str, const char* prefix, v_buff_size prefixSize) {
+    return str->getSize() >= prefixSize && std::memcmp(str->getData(), prefix, prefixSize) == 0;
+  }
+
+  bool isSameText(const oatpp::String& a, const oatpp::String& b) {
+    return a->getSize() == b->getSize() && std::memcmp(a->getData(), b->getData(), a->getSize()) == 0;
+  }
+
+  std::shared_ptr<oatpp::data::mapping::ObjectMapper> createSourceObjectMapper() {
+    // documents of other services may have fields which are not in the model
+    auto deserializerConfig = oatpp::parser::json::mapping::Deserializer::Config::createShared();
+    deserializerConfig->allowUnknownFields = true;
+    return oatpp::parser::json::mapping::ObjectMapper::createShared(oatpp::parser::json::mapping::Serializer::Config::createShared(),
+                                                                    deserializerConfig);
+  }
+
+  oatpp::String readFile(const oatpp::String& filename) {
+
+    std::ifstream file(filename->c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+    if(!file.is_open()) {
+      return nullptr;
+    }
+
+    oatpp::String result((v_int32) file.tellg());
+    file.seekg(0, std::ios::beg);
+    file.read((char*) result->getData(), result->getSize());
+    if(!file) {
+      return nullptr;
+    }
+
+    return result;
+
+  }
+
+  /*
+   * Renames components of a single source to `<source>.<name>`.
+   * Parts without references are shared with the source document.
+   */
+  class Namespace {
+  private:
+    oatpp::String m_prefix;
+    oatpp::String m_operationIdPrefix;
+  private:
+
+    oatpp::String renameRef(const oatpp::String& ref, const char* refPrefix) const {
+      v_buff_size size = (v_buff_size) std::strlen(refPrefix);
+      if(!hasPrefix(ref, refPrefix, size)) {
+        return nullptr;
+      }
+      return oatpp::String(refPrefix) + m_prefix + oatpp::String((const char*) ref->getData() + size, ref->getSize() - size, true);
+    }
+
+  public:
+
+    Namespace(const oatpp::String& name)
+      : m_prefix(name + ".")
+      , m_operationIdPrefix(name + "_")
+    {}
+
+    oatpp::String rename(const oatpp::String& name) const {
+      return m_prefix + name;
+    }
+
+    oatpp::String renameRef(const oatpp::String& ref) const {
+      if(!ref) {
+        return ref;
+      }
+      auto result = renameRef(ref, SCHEMA_REF_PREFIX);
+      if(!result) {
+        result = renameRef(ref, RESPONSE_REF_PREFIX);
+      }
+      // refs to other documents are kept as-is
+      return result ? result : ref;
+    }
+
+    oatpp::String renameOperationId(const oatpp::String& operationId) const {
+      if(!operationId) {
+        return operationId;
+      }
+      return m_operationIdPrefix + operationId;
+    }
+
+    oas3::Schema::ObjectWrapper apply(const oas3::Schema::ObjectWrapper& schema) const {
+
+      if(!schema) {
+        return schema;
+      }
+
+      auto ref = renameRef(schema->ref);
+      auto items = apply(schema->items);
+      auto additionalProperties = apply(schema->additionalProperties);
+
+      auto properties = schema->properties;
+      if(schema->properties) {
+        bool changed = false;
+        auto renamed = Fields<oas3::Schema::ObjectWrapper>::createShared();
+        auto curr = schema->properties->getFirstEntry();
+        while(curr != nullptr) {
+          auto property = apply(curr->getValue());
+          changed = changed || property.getPtr() != curr->getValue().getPtr();
+          renamed->put(curr->getKey(), property);
+          curr = curr->getNext();
+        }
+        if(changed) {
+          properties = renamed;
+        }
+      }
+
+      if(ref.getPtr() == schema->ref.getPtr() && items.getPtr() == schema->items.getPtr() &&
+         additionalProperties.getPtr() == schema->additionalProperties.getPtr() && properties.getPtr() == schema->properties.getPtr())
+      {
+        return schema;
+      }
+
+      auto result = oas3::Schema::createShared();
+      result->type = schema->type;
+      result->format = schema->format;
+      result->properties = properties;
+      result->items = items;
+      result->additionalProperties = additionalProperties;
+      result->ref = ref;
+      return result;
+
+    }
+
+    Fields<oas3::MediaTypeObject::ObjectWrapper>::ObjectWrapper apply(const Fields<oas3::MediaTypeObject::ObjectWrapper>::ObjectWrapper& content) const {
+      if(!content) {
+        return content;
+      }
+      auto result = Fields<oas3::MediaTypeObject::ObjectWrapper>::createShared();
+      auto curr = content->getFirstEntry();
+      while(curr != nullptr) {
+        oas3::MediaTypeObject::ObjectWrapper mediaType;
+        if(curr->getValue()) {
+          mediaType = oas3::MediaTypeObject::createShared();
+          mediaType->schema = apply(curr->getValue()->schema);
+        }
+        result->put(curr->getKey(), mediaType);
+        curr = curr->getNext();
+      }
+      return result;
+    }
+
+    oas3::OperationResponse::ObjectWrapper apply(const oas3::OperationResponse::ObjectWrapper& response) const {
+      if(!response) {
+        return response;
+      }
+      auto result = oas3::OperationResponse::createShared();
+      result->description = response->description;
+      result->content = apply(response->content);
+      result->ref = renameRef(response->ref);
+      return result;
+    }
+
+    List<SecurityRequirement::ObjectWrapper>::ObjectWrapper apply(const List<SecurityRequirement::ObjectWrapper>::ObjectWrapper& security) const {
+      if(!security) {
+        return security;
+      }
+      auto result = List<SecurityRequirement::ObjectWrapper>::createShared();
+      auto curr = security->getFirstNode();
+      while(curr != nullptr) {
+        SecurityRequirement::ObjectWrapper requirement;
+        if(curr->getData()) {
+          requirement = SecurityRequirement::createShared();
+          auto entry = curr->getData()->getFirstEntry();
+          while(entry != nullptr) {
+            requirement->put(rename(entry->getKey()), entry->getValue());
+            entry = entry->getNext();
+          }
+        }
+        result->pushBack(requirement);
+        curr = curr->getNext();
+      }
+      return result;
+    }
+
+    oas3::PathItemOperation::ObjectWrapper apply(const oas3::PathItemOperation::ObjectWrapper& operation) const {
+
+      if(!operation) {
+        return operation;
+      }
+
+      auto result = oas3::PathItemOperation::createShared();
+      result->description = operation->description;
+      result->summary = operation->summary;
+      result->operationId = renameOperationId(operation->operationId);
+      result->tags = operation->tags;
+      result->security = apply(operation->security);
+
+      if(operation->requestBody) {
+        result->requestBody = oas3::RequestBody::createShared();
+        result->requestBody->description = operation->requestBody->description;
+        result->requestBody->content = apply(operation->requestBody->content);
+      }
+
+      if(operation->responses) {
+        result->responses = Fields<oas3::OperationResponse::ObjectWrapper>::createShared();
+        auto curr = operation->responses->getFirstEntry();
+        while(curr != nullptr) {
+          result->responses->put(curr->getKey(), apply(curr->getValue()));
+          curr = curr->getNext();
+        }
+      }
+
+      if(operation->parameters) {
+        result->parameters = List<oas3::PathItemParameter::ObjectWrapper>::createShared();
+        auto curr = operation->parameters->getFirstNode();
+        while(curr != nullptr) {
+          auto parameter = curr->getData();
+          if(parameter) {
+            auto schema = apply(parameter->schema);
+            if(schema.getPtr() != parameter->schema.getPtr()) {
+              parameter = oas3::PathItemParameter::createShared();
+              parameter->name = curr->getData()->name;
+              parameter->description = curr->getData()->description;
+              parameter->in = curr->getData()->in;
+              parameter->required = curr->getData()->required;
+              parameter->deprecated = curr->getData()->deprecated;
+              parameter->schema = schema;
+            }
+          }
+          result->parameters->pushBack(parameter);
+          curr = curr->getNext();
+        }
+      }
+
+      return result;
+
+    }
+
+    oas3::PathItem::ObjectWrapper apply(const oas3::PathItem::ObjectWrapper& pathItem) const {
+      if(!pathItem) {
+        return pathItem;
+      }
+      auto result = oas3::PathItem::createShared();
+      result->operationGet = apply(pathItem->operationGet);
+      result->operationPut = apply(pathItem->operationPut);
+      result->operationPost = apply(pathItem->operationPost);
+      result->operationDelete = apply(pathItem->operationDelete);
+      result->operationOptions = apply(pathItem->operationOptions);
+      result->operationHead = apply(pathItem->operationHead);
+      result->operationPatch = apply(pathItem->operationPatch);
+      result->operationTrace = apply(pathItem->operationTrace);
+      return result;
+    }
+
+  };
+
+  template<class Value>
+  typename Fields<Value>::ObjectWrapper emptyToNull(const typename Fields<Value>::ObjectWrapper& fields) {
+    if(fields->count() == 0) {
+      return nullptr;
+    }
+    return fields;
+  }
+
+}
+
+DocumentAggregator::DocumentSource::DocumentSource(const oas3::Document::ObjectWrapper& document)
+  : m_document(document)
+{}
+
+void DocumentAggregator::DocumentSource::setDocument(const oas3::Document::ObjectWrapper& document) {
+  std::lock_guard<std::mutex> lock(m_lock);
+  m_document = document;
+}
+
+oas3::Document::ObjectWrapper DocumentAggregator::DocumentSource::getDocument() {
+  std::lock_guard<std::mutex> lock(m_lock);
+  return m_document;
+}
+
+DocumentAggregator::TextSource::TextSource(const Fetch& fetch, const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper)
+  : m_fetch(fetch)
+  , m_objectMapper(objectMapper ? objectMapper : createSourceObjectMapper())
+{}
+
+oas3::Document::ObjectWrapper DocumentAggregator::TextSource::getDocument() {
+
+  oatpp::String text;
+  try {
+    text = m_fetch();
+  } catch (std::exception& e) {
+    OATPP_LOGW("[oatpp::swagger::DocumentAggregator::TextSource::getDocument()]", "Warning. Can't fetch document: %s", e.what());
+    return m_document;
+  }
+
+  if(!text || (m_text && isSameText(text, m_text))) {
+    return m_document;
+  }
+
+  // broken text is not parsed again until it changes
+  m_text = text;
+
+  try {
+    oatpp::parser::Caret caret(text);
+    auto document = m_objectMapper->readFromCaret<oas3::Document>(caret);
+    if(caret.hasError()) {
+      OATPP_LOGW("[oatpp::swagger::DocumentAggregator::TextSource::getDocument()]", "Warning. Can't parse document, keeping the previous one: %s", caret.getErrorMessage());
+    } else if(document) {
+      m_document = document;
+    }
+  } catch (std::exception& e) {
+    OATPP_LOGW("[oatpp::swagger::DocumentAggregator::TextSource::getDocument()]", "Warning. Can't parse document, keeping the previous one: %s", e.what());
+  }
+
+  return m_document;
+
+}
+
+DocumentAggregator::FileSource::FileSource(const oatpp::String& filename, const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper)
+  : TextSource([filename] { return readFile(filename); }, objectMapper)
+{}
+
+DocumentAggregator::DocumentAggregator(const std::shared_ptr<DocumentInfo>& documentInfo,
+                                       const std::shared_ptr<ControllerConfig>& config,
+                                       const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper)
+  : m_objectMapper(objectMapper)
+  , m_config(config)
+{
+
+  OATPP_ASSERT(documentInfo && "[oatpp::swagger::DocumentAggregator::DocumentAggregator()]: Error. DocumentInfo should not be null.");
+
+  if(!m_objectMapper) {
+
+    auto serializerConfig = oatpp::parser::json::mapping::Serializer::Config::createShared();
+    serializerConfig->includeNullFields = false;
+
+    auto deserializerConfig = oatpp::parser::json::mapping::Deserializer::Config::createShared();
+    deserializerConfig->allowUnknownFields = false;
+
+    m_objectMapper = oatpp::parser::json::mapping::ObjectMapper::createShared(serializerConfig, deserializerConfig);
+
+  }
+
+  // info and servers of the combined document
+  m_header = oas3::Generator::generateDocument(documentInfo, oas3::Generator::Endpoints::createShared());
+  m_publisher = DocumentPublisher::createShared(m_objectMapper, nullptr, m_config, nullptr);
+
+}
+
+bool DocumentAggregator::isValidName(const oatpp::String& name) {
+  if(!name || name->getSize() == 0) {
+    return false;
+  }
+  auto data = name->getData();
+  for(v_buff_size i = 0; i < name->getSize(); i ++) {
+    v_char8 a = data[i];
+    if(!((a >= 'a' && a <= 'z') || (a >= 'A' && a <= 'Z') || (a >= '0' && a <= '9') || a == '-' || a == '_')) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void DocumentAggregator::buildPart(Part& part) {
+
+  Namespace ns(part.name);
+
+  part.paths = Fields<oas3::PathItem::ObjectWrapper>::createShared();
+  part.schemas = Fields<oas3::Schema::ObjectWrapper>::createShared();
+  part.responses = Fields<oas3::OperationResponse::ObjectWrapper>::createShared();
+  part.securitySchemes = Fields<oas3::SecurityScheme::ObjectWrapper>::createShared();
+
+  auto document = part.document;
+  if(!document) {
+    return;
+  }
+
+  if(document->paths) {
+    auto curr = document->paths->getFirstEntry();
+    while(curr != nullptr) {
+      auto path = part.pathPrefix ? part.pathPrefix + curr->getKey() : curr->getKey();
+      part.paths->put(path, ns.apply(curr->getValue()));
+      curr = curr->getNext();
+    }
+  }
+
+  auto components = document->components;
+  if(!components) {
+    return;
+  }
+
+  if(components->schemas) {
+    auto curr = components->schemas->getFirstEntry();
+    while(curr != nullptr) {
+      part.schemas->put(ns.rename(curr->getKey()), ns.apply(curr->getValue()));
+      curr = curr->getNext();
+    }
+  }
+
+  if(components->responses) {
+    auto curr = components->responses->getFirstEntry();
+    while(curr != nullptr) {
+      part.responses->put(ns.rename(curr->getKey()), ns.apply(curr->getValue()));
+      curr = curr->getNext();
+    }
+  }
+
+  if(components->securitySchemes) {
+    auto curr = components->securitySchemes->getFirstEntry();
+    while(curr != nullptr) {
+      part.securitySchemes->put(ns.rename(curr->getKey()), curr->getValue());
+      curr = curr->getNext();
+    }
+  }
+
+}
+
+DocumentAggregator& DocumentAggregator::addSource(const oatpp::String& name,
+                                                  const std::shared_ptr<Source>& source,
+                                                  const oatpp::String& pathPrefix)
+{
+
+  OATPP_ASSERT(isValidName(name) && "[oatpp::swagger::DocumentAggregator::addSource()]: Error. Invalid source name.");
+  OATPP_ASSERT(source && "[oatpp::swagger::DocumentAggregator::addSource()]: Error. Source should not be null.");
+
+  std::lock_guard<std::mutex> lock(m_lock);
+
+  for(auto& part : m_parts) {
+    OATPP_ASSERT(!isSameText(part.name, name) && "[oatpp::swagger::DocumentAggregator::addSource()]: Error. Source with the same name already exists.");
+  }
+
+  Part part;
+  part.name = name;
+  part.pathPrefix = pathPrefix;
+  part.source = source;
+  m_parts.push_back(part);
+
+  return *this;
+
+}
+
+v_int32 DocumentAggregator::refresh() {
+
+  std::lock_guard<std::mutex> lock(m_lock);
+
+  v_int32 rebuilt = 0;
+  for(auto& part : m_parts) {
+    auto document = part.source->getDocument();
+    if(!part.paths || document.getPtr() != part.document.getPtr()) {
+      part.document = document;
+      buildPart(part);
+      rebuilt ++;
+    }
+  }
+
+  if(rebuilt == 0 && m_publisher->isReady()) {
+    return 0;
+  }
+
+  auto document = oas3::Document::createShared();
+  document->openapi = m_header->openapi;
+  document->info = m_header->info;
+  document->servers = m_header->servers;
+  document->paths = Fields<oas3::PathItem::ObjectWrapper>::createShared();
+
+  auto schemas = Fields<oas3::Schema::ObjectWrapper>::createShared();
+  auto responses = Fields<oas3::OperationResponse::ObjectWrapper>::createShared();
+  auto securitySchemes = Fields<oas3::SecurityScheme::ObjectWrapper>::createShared();
+
+  std::unordered_set<oatpp::String> paths;
+
+  for(auto& part : m_parts) {
+
+    auto curr = part.paths->getFirstEntry();
+    while(curr != nullptr) {
+      if(paths.insert(curr->getKey()).second) {
+        document->paths->put(curr->getKey(), curr->getValue());
+      } else {
+        OATPP_LOGW("[oatpp::swagger::DocumentAggregator::refresh()]", "Warning. Path '%s' of source '%s' is already defined by another source, skipped.",
+                   curr->getKey()->c_str(), part.name->c_str());
+      }
+      curr = curr->getNext();
+    }
+
+    // component names are unique - they are namespaced by unique source names
+    auto schema = part.schemas->getFirstEntry();
+    while(schema != nullptr) {
+      schemas->put(schema->getKey(), schema->getValue());
+      schema = schema->getNext();
+    }
+
+    auto response = part.responses->getFirstEntry();
+    while(response != nullptr) {
+      responses->put(response->getKey(), response->getValue());
+      response = response->getNext();
+    }
+
+    auto securityScheme = part.securitySchemes->getFirstEntry();
+    while(securityScheme != nullptr) {
+      securitySchemes->put(securityScheme->getKey(), securityScheme->getValue());
+      securityScheme = securityScheme->getNext();
+    }
+
+  }
+
+  document->components = oas3::Components::createShared();
+  document->components->schemas = schemas;
+  document->components->responses = emptyToNull<oas3::OperationResponse::ObjectWrapper>(responses);
+  document->components->securitySchemes = emptyToNull<oas3::SecurityScheme::ObjectWrapper>(securitySchemes);
+
+  oatpp::String json;
+  if(!m_config || !m_config->streamDocument) {
+    // path items and schemas of unchanged sources are the same objects, so their JSON is reused
+    json = DocumentStream::serialize(m_objectMapper, document, m_fragments, m_config && m_config->useJsonWriter);
+  }
+
+  m_publisher->publish(DocumentCache::createShared(m_objectMapper, document, m_config, json));
+
+  return rebuilt;
+
+}
+
+std::shared_ptr<DocumentPublisher> DocumentAggregator::getPublisher() const {
+  return m_publisher;
+}
+
+std::shared_ptr<oatpp::data::mapping::ObjectMapper> DocumentAggregator::getObjectMapper() const {
+  return m_objectMapper;
+}
+
+}}
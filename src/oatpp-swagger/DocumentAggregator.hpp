@@ -0,0 +1,270 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_swagger_DocumentAggregator_hpp
+#define oatpp_swagger_DocumentAggregator_hpp
+
+#include "oatpp-swagger/DocumentPublisher.hpp"
+#include "oatpp-swagger/DocumentStream.hpp"
+
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace oatpp { namespace swagger {
+
+/**
+ * Combines documents of several services into one document. <br>
+ * Each source is merged under its own namespace: paths are prefixed with the source path prefix,
+ * components (schemas, responses, security schemes) are renamed to `<source>.<name>`, `$ref`s, security requirements
+ * and operation ids are rewritten accordingly. Info and servers of the combined document come from the aggregator &id:oatpp::swagger::DocumentInfo;. <br>
+ * Combined document is published as &id:oatpp::swagger::DocumentCache; through the aggregator &id:oatpp::swagger::DocumentPublisher;,
+ * so it may be served with &id:oatpp::swagger::Controller::createShared; or &id:oatpp::swagger::AsyncController::createShared;. <br>
+ * &l:DocumentAggregator::refresh (); rebuilds namespaced parts of changed sources only. Parts of other sources are reused as-is,
+ * and so are their serialized path items and schemas.
+ */
+class DocumentAggregator {
+public:
+
+  template <class Value>
+  using Fields = oatpp::data::mapping::type::ListMap<String, Value>;
+
+public:
+
+  /**
+   * Source of the document to aggregate.
+   */
+  class Source {
+  public:
+
+    /**
+     * Default virtual destructor.
+     */
+    virtual ~Source() = default;
+
+    /**
+     * Get current document of the source. <br>
+     * Called on each &l:DocumentAggregator::refresh ();. Source should return the same object while the document doesn't change.
+     * @return - &id:oatpp::swagger::oas3::Document;. `nullptr` - source has no document yet.
+     */
+    virtual oas3::Document::ObjectWrapper getDocument() = 0;
+
+  };
+
+  /**
+   * Source of the document generated in the same process (ex.: &id:oatpp::swagger::DocumentCache::getDocument;).
+   */
+  class DocumentSource : public Source {
+  private:
+    std::mutex m_lock;
+    oas3::Document::ObjectWrapper m_document;
+  public:
+
+    /**
+     * Constructor.
+     * @param document - initial &id:oatpp::swagger::oas3::Document;. May be `nullptr`.
+     */
+    DocumentSource(const oas3::Document::ObjectWrapper& document = nullptr);
+
+    /**
+     * Create shared DocumentSource.
+     * @param document - initial &id:oatpp::swagger::oas3::Document;. May be `nullptr`.
+     * @return - `std::shared_ptr` to DocumentSource.
+     */
+    static std::shared_ptr<DocumentSource> createShared(const oas3::Document::ObjectWrapper& document = nullptr) {
+      return std::make_shared<DocumentSource>(document);
+    }
+
+    /**
+     * Replace the document. Document is never modified, so a new object should be passed for the changed document.
+     * @param document - &id:oatpp::swagger::oas3::Document;.
+     */
+    void setDocument(const oas3::Document::ObjectWrapper& document);
+
+    oas3::Document::ObjectWrapper getDocument() override;
+
+  };
+
+  /**
+   * Source of the document fetched as JSON text (ex.: from `/api-docs/oas-3.0.0.json` of a local service). <br>
+   * Text is parsed only when it differs from the previously fetched one.
+   * If fetch fails or the text can't be parsed, the last good document is kept.
+   */
+  class TextSource : public Source {
+  public:
+    /**
+     * Fetch function. Returns document JSON or `nullptr` if the document is not available.
+     */
+    typedef std::function<oatpp::String()> Fetch;
+  private:
+    Fetch m_fetch;
+    std::shared_ptr<oatpp::data::mapping::ObjectMapper> m_objectMapper;
+    oatpp::String m_text;
+    oas3::Document::ObjectWrapper m_document;
+  public:
+
+    /**
+     * Constructor.
+     * @param fetch - &l:DocumentAggregator::TextSource::Fetch;.
+     * @param objectMapper - &id:oatpp::data::mapping::ObjectMapper; used to parse the document.
+     * `nullptr` - use JSON object mapper which skips fields not covered by &id:oatpp::swagger::oas3::Document;.
+     */
+    TextSource(const Fetch& fetch, const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper = nullptr);
+
+    /**
+     * Create shared TextSource.
+     * @param fetch - &l:DocumentAggregator::TextSource::Fetch;.
+     * @param objectMapper - &id:oatpp::data::mapping::ObjectMapper; used to parse the document. May be `nullptr`.
+     * @return - `std::shared_ptr` to TextSource.
+     */
+    static std::shared_ptr<TextSource> createShared(const Fetch& fetch,
+                                                    const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper = nullptr)
+    {
+      return std::make_shared<TextSource>(fetch, objectMapper);
+    }
+
+    oas3::Document::ObjectWrapper getDocument() override;
+
+  };
+
+  /**
+   * Source of the document stored in a local JSON file. File is re-read on each &l:DocumentAggregator::refresh ();.
+   */
+  class FileSource : public TextSource {
+  public:
+
+    /**
+     * Constructor.
+     * @param filename - path to the document file.
+     * @param objectMapper - &id:oatpp::data::mapping::ObjectMapper; used to parse the document. May be `nullptr`.
+     */
+    FileSource(const oatpp::String& filename, const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper = nullptr);
+
+    /**
+     * Create shared FileSource.
+     * @param filename - path to the document file.
+     * @param objectMapper - &id:oatpp::data::mapping::ObjectMapper; used to parse the document. May be `nullptr`.
+     * @return - `std::shared_ptr` to FileSource.
+     */
+    static std::shared_ptr<FileSource> createShared(const oatpp::String& filename,
+                                                    const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper = nullptr)
+    {
+      return std::make_shared<FileSource>(filename, objectMapper);
+    }
+
+  };
+
+private:
+
+  /*
+   * Namespaced part of the combined document built from a single source document.
+   */
+  struct Part {
+    oatpp::String name;
+    oatpp::String pathPrefix;
+    std::shared_ptr<Source> source;
+    oas3::Document::ObjectWrapper document;
+    Fields<oas3::PathItem::ObjectWrapper>::ObjectWrapper paths;
+    Fields<oas3::Schema::ObjectWrapper>::ObjectWrapper schemas;
+    Fields<oas3::OperationResponse::ObjectWrapper>::ObjectWrapper responses;
+    Fields<oas3::SecurityScheme::ObjectWrapper>::ObjectWrapper securitySchemes;
+  };
+
+private:
+  static bool isValidName(const oatpp::String& name);
+  static void buildPart(Part& part);
+private:
+  std::shared_ptr<oatpp::data::mapping::ObjectMapper> m_objectMapper;
+  std::shared_ptr<ControllerConfig> m_config;
+  oas3::Document::ObjectWrapper m_header;
+  std::shared_ptr<DocumentPublisher> m_publisher;
+  std::mutex m_lock;
+  std::vector<Part> m_parts;
+  DocumentStream::Fragments m_fragments;
+public:
+
+  /**
+   * Constructor.
+   * @param documentInfo - &id:oatpp::swagger::DocumentInfo; of the combined document. Only header and servers are used.
+   * @param config - &id:oatpp::swagger::ControllerConfig; of the combined document.
+   * @param objectMapper - &id:oatpp::data::mapping::ObjectMapper; used to serialize the combined document.
+   * `nullptr` - use JSON object mapper configured the same way as in &id:oatpp::swagger::Controller::createShared;.
+   */
+  DocumentAggregator(const std::shared_ptr<DocumentInfo>& documentInfo,
+                     const std::shared_ptr<ControllerConfig>& config = ControllerConfig::createShared(),
+                     const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper = nullptr);
+public:
+
+  /**
+   * Create shared DocumentAggregator.
+   * @param documentInfo - &id:oatpp::swagger::DocumentInfo; of the combined document.
+   * @param config - &id:oatpp::swagger::ControllerConfig; of the combined document.
+   * @param objectMapper - &id:oatpp::data::mapping::ObjectMapper; used to serialize the combined document. May be `nullptr`.
+   * @return - `std::shared_ptr` to DocumentAggregator.
+   */
+  static std::shared_ptr<DocumentAggregator> createShared(const std::shared_ptr<DocumentInfo>& documentInfo,
+                                                          const std::shared_ptr<ControllerConfig>& config = ControllerConfig::createShared(),
+                                                          const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper = nullptr)
+  {
+    return std::make_shared<DocumentAggregator>(documentInfo, config, objectMapper);
+  }
+
+  /**
+   * Add source. Sources are merged in the order they were added.
+   * If several sources have the same path after prefixing, the path of the first source is kept. <br>
+   * Source document is picked up on the next &l:DocumentAggregator::refresh ();.
+   * @param name - source name. Used as the namespace of source components, so it may contain only latin letters, digits, `-` and `_`.
+   * @param source - &l:DocumentAggregator::Source;.
+   * @param pathPrefix - prefix of source paths (ex.: `/users`). `nullptr` - keep paths as-is.
+   * @return - this DocumentAggregator.
+   */
+  DocumentAggregator& addSource(const oatpp::String& name,
+                                const std::shared_ptr<Source>& source,
+                                const oatpp::String& pathPrefix = nullptr);
+
+  /**
+   * Poll all sources, rebuild parts of sources whose documents changed and publish the combined document
+   * if any part changed.
+   * @return - number of rebuilt source parts. `0` - combined document was not changed.
+   */
+  v_int32 refresh();
+
+  /**
+   * Get &id:oatpp::swagger::DocumentPublisher; of the combined document.
+   * @return - `std::shared_ptr` to &id:oatpp::swagger::DocumentPublisher;.
+   */
+  std::shared_ptr<DocumentPublisher> getPublisher() const;
+
+  /**
+   * Get &id:oatpp::data::mapping::ObjectMapper; used to serialize the combined document.
+   * @return - `std::shared_ptr` to &id:oatpp::data::mapping::ObjectMapper;.
+   */
+  std::shared_ptr<oatpp::data::mapping::ObjectMapper> getObjectMapper() const;
+
+};
+
+}}
+
+#endif /* oatpp_swagger_DocumentAggregator_hpp */
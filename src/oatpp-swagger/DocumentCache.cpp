@@ -0,0 +1,300 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "DocumentCache.hpp"
+
+#include "oatpp-swagger/oas3/DocumentFilter.hpp"
+#include "oatpp-swagger/oas3/JsonWriter.hpp"
+#include "oatpp-swagger/oas3/YamlWriter.hpp"
+
+#include "oatpp/web/protocol/http/outgoing/StreamingBody.hpp"
+#include "oatpp/web/protocol/http/Http.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace oatpp { namespace swagger {
+
+DocumentCache::DocumentCache(const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper,
+                             const oas3::Document::ObjectWrapper& document,
+                             const std::shared_ptr<ControllerConfig>& config,
+                             const oatpp::String& json,
+                             const oatpp::String& fingerprint)
+  : m_objectMapper(objectMapper)
+  , m_config(config ? config : ControllerConfig::createShared())
+  , m_streamBufferSize(config ? config->streamBufferSize : 16 * 1024)
+{
+
+  OATPP_ASSERT(objectMapper && "[oatpp::swagger::DocumentCache::DocumentCache()]: Error. ObjectMapper should not be null.");
+  OATPP_ASSERT(document && "[oatpp::swagger::DocumentCache::DocumentCache()]: Error. Document should not be null.");
+
+  bool streamDocument = config && config->streamDocument;
+
+  if(!config || config->keepDocument || streamDocument) {
+    m_document = document;
+    oas3::DocumentFilter::collectTags(document, m_documentTags);
+  }
+
+  if(!streamDocument) {
+    m_json = Representation::createShared("application/json", json ? json : writeJson(document), config);
+  } else if(fingerprint) {
+    // streamed bytes are not hashed - fingerprint of the inputs changes whenever the document does
+    m_streamETag = "\"" + fingerprint + "\"";
+  }
+
+  if(m_config->enableYaml) {
+    m_yaml = renderYaml(document);
+  }
+
+  if(m_config->enableLite) {
+    m_liteJson = renderLiteJson(document);
+  }
+
+}
+
+std::shared_ptr<Representation> DocumentCache::renderYaml(const oas3::Document::ObjectWrapper& document) const {
+  return Representation::createShared("application/yaml", oas3::YamlWriter::write(document), m_config);
+}
+
+std::shared_ptr<Representation> DocumentCache::renderLiteJson(const oas3::Document::ObjectWrapper& document) const {
+  auto liteDocument = oas3::DocumentFilter::createLiteDocument(document);
+  return Representation::createShared("application/json", writeJson(liteDocument), m_config);
+}
+
+oatpp::String DocumentCache::writeJson(const oas3::Document::ObjectWrapper& document) const {
+  if(m_config->useJsonWriter) {
+    return oas3::JsonWriter::write(document);
+  }
+  return m_objectMapper->writeToString(document);
+}
+
+oas3::Document::ObjectWrapper DocumentCache::getDocument() const {
+  return m_document;
+}
+
+std::shared_ptr<Representation> DocumentCache::getJson() const {
+  return m_json;
+}
+
+std::shared_ptr<DocumentStream> DocumentCache::createJsonStream() const {
+  if(m_document) {
+    return std::make_shared<DocumentStream>(m_objectMapper, m_document, m_streamBufferSize, m_config->useJsonWriter);
+  }
+  return nullptr;
+}
+
+std::shared_ptr<DocumentCache::OutgoingResponse> DocumentCache::createJsonResponse(const oatpp::String& acceptEncoding,
+                                                                                  const oatpp::String& ifNoneMatch) const
+{
+
+  if(m_json) {
+    return m_json->createResponse(acceptEncoding, ifNoneMatch);
+  }
+
+  typedef oatpp::web::protocol::http::Header Header;
+  typedef oatpp::web::protocol::http::Status Status;
+
+  std::shared_ptr<OutgoingResponse> response;
+
+  if(m_streamETag && ifNoneMatch && Representation::matchETag(ifNoneMatch, m_streamETag)) {
+    response = OutgoingResponse::createShared(Status::CODE_304, nullptr);
+  } else {
+    auto body = std::make_shared<oatpp::web::protocol::http::outgoing::StreamingBody>(createJsonStream());
+    response = OutgoingResponse::createShared(Status::CODE_200, body);
+    response->putHeader(Header::CONTENT_TYPE, "application/json");
+  }
+
+  if(m_streamETag) {
+    response->putHeader("ETag", m_streamETag);
+  }
+
+  if(m_config->cacheControl) {
+    response->putHeader("Cache-Control", m_config->cacheControl);
+  }
+
+  return response;
+
+}
+
+std::shared_ptr<Representation> DocumentCache::getYaml() const {
+  return m_yaml;
+}
+
+std::shared_ptr<Representation> DocumentCache::getLiteJson() const {
+  return m_liteJson;
+}
+
+std::string DocumentCache::normalizeTags(const oatpp::String& tags,
+                                        const std::unordered_set<oatpp::String>& knownTags,
+                                        std::unordered_set<oatpp::String>& tagSet)
+{
+
+  std::vector<std::string> list;
+
+  if(tags) {
+    const char* data = (const char*) tags->getData();
+    v_buff_size size = tags->getSize();
+    v_buff_size pos = 0;
+    while(pos <= size) {
+      v_buff_size end = pos;
+      while(end < size && data[end] != ',') {
+        end ++;
+      }
+      v_buff_size begin = pos;
+      v_buff_size last = end;
+      while(begin < last && (data[begin] == ' ' || data[begin] == '\t')) {
+        begin ++;
+      }
+      while(last > begin && (data[last - 1] == ' ' || data[last - 1] == '\t')) {
+        last --;
+      }
+      if(last > begin) {
+        auto it = knownTags.find(oatpp::String((const char*) &data[begin], last - begin, false));
+        if(it != knownTags.end()) {
+          list.push_back(std::string((const char*) (*it)->getData(), (*it)->getSize()));
+          tagSet.insert(*it);
+        }
+      }
+      pos = end + 1;
+    }
+  }
+
+  std::sort(list.begin(), list.end());
+  list.erase(std::unique(list.begin(), list.end()), list.end());
+
+  std::string result;
+  for(const auto& tag : list) {
+    if(!result.empty()) {
+      result += ",";
+    }
+    result += tag;
+  }
+
+  return result;
+
+}
+
+std::string DocumentCache::getTaggedKey(const oatpp::String& tags, std::unordered_set<oatpp::String>& tagSet) const {
+  auto key = normalizeTags(tags, m_documentTags, tagSet);
+  OATPP_ASSERT_HTTP((v_int64) tagSet.size() <= m_config->maxFilterTags,
+                    oatpp::web::protocol::http::Status::CODE_400, "Too many tags");
+  return key;
+}
+
+std::shared_ptr<Representation> DocumentCache::findTagged(const std::string& key) const {
+  std::lock_guard<std::mutex> lock(m_taggedLock);
+  auto it = m_taggedIndex.find(key);
+  if(it != m_taggedIndex.end()) {
+    m_taggedList.splice(m_taggedList.begin(), m_taggedList, it->second);
+    return it->second->second;
+  }
+  return nullptr;
+}
+
+std::shared_ptr<Representation> DocumentCache::getTaggedJson(const oatpp::String& tags) const {
+
+  if(!m_document) {
+    return nullptr;
+  }
+
+  std::unordered_set<oatpp::String> tagSet;
+  auto key = getTaggedKey(tags, tagSet);
+
+  auto cached = findTagged(key);
+  if(cached) {
+    return cached;
+  }
+
+  // render outside of the lock - concurrent misses on the same key may render twice, first one is kept.
+  auto document = oas3::DocumentFilter::createTaggedDocument(m_document, tagSet);
+  auto result = Representation::createShared("application/json", writeJson(document), m_config);
+
+  if(m_config->taggedDocumentCacheSize <= 0) {
+    return result;
+  }
+
+  std::lock_guard<std::mutex> lock(m_taggedLock);
+
+  auto it = m_taggedIndex.find(key);
+  if(it != m_taggedIndex.end()) {
+    return it->second->second;
+  }
+
+  m_taggedList.push_front(std::make_pair(key, result));
+  m_taggedIndex[key] = m_taggedList.begin();
+
+  while((v_int64) m_taggedList.size() > m_config->taggedDocumentCacheSize) {
+    m_taggedIndex.erase(m_taggedList.back().first);
+    m_taggedList.pop_back();
+  }
+
+  return result;
+
+}
+
+std::shared_ptr<Representation> DocumentCache::findTaggedJson(const oatpp::String& tags) const {
+
+  if(!m_document) {
+    return nullptr;
+  }
+
+  std::unordered_set<oatpp::String> tagSet;
+  return findTagged(getTaggedKey(tags, tagSet));
+
+}
+
+std::shared_future<std::shared_ptr<Representation>> DocumentCache::renderTaggedJsonAsync(const oatpp::String& tags) const {
+
+  std::unordered_set<oatpp::String> tagSet;
+  auto key = getTaggedKey(tags, tagSet);
+
+  std::lock_guard<std::mutex> lock(m_taggedLock);
+
+  auto it = m_taggedPending.find(key);
+  if(it != m_taggedPending.end()) {
+    return it->second;
+  }
+
+  auto promise = std::make_shared<std::promise<std::shared_ptr<Representation>>>();
+  TaggedFuture future = promise->get_future().share();
+  m_taggedPending[key] = future;
+
+  // thread keeps the cache alive - request which started the rendering may be gone by the time it is done.
+  auto self = shared_from_this();
+  std::thread([self, key, tags, promise] {
+    try {
+      promise->set_value(self->getTaggedJson(tags));
+    } catch (...) {
+      promise->set_exception(std::current_exception());
+    }
+    std::lock_guard<std::mutex> lock(self->m_taggedLock);
+    self->m_taggedPending.erase(key);
+  }).detach();
+
+  return future;
+
+}
+
+}}
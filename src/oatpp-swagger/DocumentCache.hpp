@@ -0,0 +1,197 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_swagger_DocumentCache_hpp
+#define oatpp_swagger_DocumentCache_hpp
+
+#include "oatpp-swagger/DocumentStream.hpp"
+#include "oatpp-swagger/Representation.hpp"
+#include "oatpp-swagger/oas3/Model.hpp"
+
+#include "oatpp/core/data/mapping/ObjectMapper.hpp"
+
+#include <future>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace oatpp { namespace swagger {
+
+/**
+ * Pre-serialized &id:oatpp::swagger::oas3::Document;. <br>
+ * Document is serialized to JSON, YAML and lite JSON once on construction and the resulting bytes are served as-is
+ * by &id:oatpp::swagger::Controller; and &id:oatpp::swagger::AsyncController;. <br>
+ * If &id:oatpp::swagger::ControllerConfig::streamDocument; is set, JSON is not pre-serialized and is streamed with
+ * &id:oatpp::swagger::DocumentStream; instead. Other renderings are pre-serialized in this mode as well. <br>
+ * Tag-filtered renderings are created on demand and kept in a bounded LRU cache
+ * (see &id:oatpp::swagger::ControllerConfig::taggedDocumentCacheSize;). <br>
+ * DocumentCache may be shared between threads. It should be created with &l:DocumentCache::createShared ();.
+ */
+class DocumentCache : public std::enable_shared_from_this<DocumentCache> {
+public:
+  typedef oatpp::web::protocol::http::outgoing::Response OutgoingResponse;
+private:
+  typedef std::list<std::pair<std::string, std::shared_ptr<Representation>>> TaggedList;
+  typedef std::shared_future<std::shared_ptr<Representation>> TaggedFuture;
+private:
+  static std::string normalizeTags(const oatpp::String& tags,
+                                   const std::unordered_set<oatpp::String>& knownTags,
+                                   std::unordered_set<oatpp::String>& tagSet);
+private:
+  std::string getTaggedKey(const oatpp::String& tags, std::unordered_set<oatpp::String>& tagSet) const;
+  std::shared_ptr<Representation> findTagged(const std::string& key) const;
+  oatpp::String writeJson(const oas3::Document::ObjectWrapper& document) const;
+  std::shared_ptr<Representation> renderYaml(const oas3::Document::ObjectWrapper& document) const;
+  std::shared_ptr<Representation> renderLiteJson(const oas3::Document::ObjectWrapper& document) const;
+private:
+  std::shared_ptr<oatpp::data::mapping::ObjectMapper> m_objectMapper;
+  std::shared_ptr<ControllerConfig> m_config;
+  v_buff_size m_streamBufferSize;
+  oas3::Document::ObjectWrapper m_document;
+  std::unordered_set<oatpp::String> m_documentTags;
+  std::shared_ptr<Representation> m_json;
+  std::shared_ptr<Representation> m_yaml;
+  std::shared_ptr<Representation> m_liteJson;
+  oatpp::String m_streamETag;
+private:
+  mutable std::mutex m_taggedLock;
+  mutable TaggedList m_taggedList;
+  mutable std::unordered_map<std::string, TaggedList::iterator> m_taggedIndex;
+  mutable std::unordered_map<std::string, TaggedFuture> m_taggedPending;
+public:
+
+  /**
+   * Constructor.
+   * @param objectMapper - &id:oatpp::data::mapping::ObjectMapper; used to serialize document.
+   * @param document - &id:oatpp::swagger::oas3::Document;.
+   * @param config - &id:oatpp::swagger::ControllerConfig;.
+   * @param json - already serialized document. `nullptr` - serialize document with the `objectMapper`.
+   * @param fingerprint - fingerprint of the document inputs used as `ETag` of the streamed document
+   * (see &id:oatpp::swagger::oas3::Generator::computeFingerprint;). `nullptr` - streamed document has no `ETag`.
+   */
+  DocumentCache(const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper,
+                const oas3::Document::ObjectWrapper& document,
+                const std::shared_ptr<ControllerConfig>& config,
+                const oatpp::String& json = nullptr,
+                const oatpp::String& fingerprint = nullptr);
+public:
+
+  /**
+   * Create shared DocumentCache.
+   * @param objectMapper - &id:oatpp::data::mapping::ObjectMapper; used to serialize document.
+   * @param document - &id:oatpp::swagger::oas3::Document;.
+   * @param config - &id:oatpp::swagger::ControllerConfig;.
+   * @param json - already serialized document. `nullptr` - serialize document with the `objectMapper`.
+   * @param fingerprint - fingerprint of the document inputs used as `ETag` of the streamed document
+   * (see &id:oatpp::swagger::oas3::Generator::computeFingerprint;). `nullptr` - streamed document has no `ETag`.
+   * @return - `std::shared_ptr` to DocumentCache.
+   */
+  static std::shared_ptr<DocumentCache> createShared(const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper,
+                                                     const oas3::Document::ObjectWrapper& document,
+                                                     const std::shared_ptr<ControllerConfig>& config,
+                                                     const oatpp::String& json = nullptr,
+                                                     const oatpp::String& fingerprint = nullptr)
+  {
+    return std::make_shared<DocumentCache>(objectMapper, document, config, json, fingerprint);
+  }
+
+  /**
+   * Get document DTO.
+   * @return - &id:oatpp::swagger::oas3::Document;. `nullptr` if &id:oatpp::swagger::ControllerConfig::keepDocument; is `false`.
+   */
+  oas3::Document::ObjectWrapper getDocument() const;
+
+  /**
+   * Get JSON rendering of the document.
+   * @return - `std::shared_ptr` to &id:oatpp::swagger::Representation;. `nullptr` if &id:oatpp::swagger::ControllerConfig::streamDocument; is `true`.
+   */
+  std::shared_ptr<Representation> getJson() const;
+
+  /**
+   * Create stream of the document JSON.
+   * @return - `std::shared_ptr` to &id:oatpp::swagger::DocumentStream;. `nullptr` if document DTO is not kept.
+   */
+  std::shared_ptr<DocumentStream> createJsonStream() const;
+
+  /**
+   * Create response with the document JSON. <br>
+   * Pre-serialized JSON is served if available, otherwise JSON is streamed. Streamed response is not compressed.
+   * It carries `Cache-Control` and, if the fingerprint was given, `ETag` - so that it may be answered with `304 Not Modified`.
+   * @param acceptEncoding - value of `Accept-Encoding` header. May be `nullptr`.
+   * @param ifNoneMatch - value of `If-None-Match` header. May be `nullptr`.
+   * @return - `std::shared_ptr` to &id:oatpp::web::protocol::http::outgoing::Response;.
+   */
+  std::shared_ptr<OutgoingResponse> createJsonResponse(const oatpp::String& acceptEncoding, const oatpp::String& ifNoneMatch) const;
+
+  /**
+   * Get YAML rendering of the document.
+   * @return - `std::shared_ptr` to &id:oatpp::swagger::Representation;. `nullptr` if &id:oatpp::swagger::ControllerConfig::enableYaml; is `false`.
+   */
+  std::shared_ptr<Representation> getYaml() const;
+
+  /**
+   * Get JSON rendering of the "lite" document.
+   * @return - `std::shared_ptr` to &id:oatpp::swagger::Representation;. `nullptr` if &id:oatpp::swagger::ControllerConfig::enableLite; is `false`.
+   */
+  std::shared_ptr<Representation> getLiteJson() const;
+
+  /**
+   * Get JSON rendering of the sub-document containing only operations with the given tags. <br>
+   * See &id:oatpp::swagger::oas3::DocumentFilter::createTaggedDocument;. <br>
+   * Tags are normalized (trimmed, deduplicated and sorted) so that `"b,a"` and `"a, b"` share the same rendering.
+   * Tags not used by any operation of the document are ignored, so they don't create new renderings.
+   * @param tags - comma-separated list of tags.
+   * @return - `std::shared_ptr` to &id:oatpp::swagger::Representation;. `nullptr` if document DTO is not kept.
+   * @throws - &id:oatpp::web::protocol::http::HttpError; `400` if there are more known tags than
+   * &id:oatpp::swagger::ControllerConfig::maxFilterTags;.
+   */
+  std::shared_ptr<Representation> getTaggedJson(const oatpp::String& tags) const;
+
+  /**
+   * Get already rendered JSON of the tag-filtered sub-document. Never renders. <br>
+   * Used by &id:oatpp::swagger::AsyncController; to answer from the cache on the executor thread.
+   * @param tags - comma-separated list of tags.
+   * @return - `std::shared_ptr` to &id:oatpp::swagger::Representation;. `nullptr` if rendering is not cached
+   * or document DTO is not kept.
+   * @throws - &id:oatpp::web::protocol::http::HttpError; `400` if there are more known tags than
+   * &id:oatpp::swagger::ControllerConfig::maxFilterTags;.
+   */
+  std::shared_ptr<Representation> findTaggedJson(const oatpp::String& tags) const;
+
+  /**
+   * Render JSON of the tag-filtered sub-document on a separate thread - same as &l:DocumentCache::getTaggedJson ();. <br>
+   * Concurrent calls for the same normalized tags share one rendering.
+   * @param tags - comma-separated list of tags.
+   * @return - `std::shared_future` of &id:oatpp::swagger::Representation;. Errors of &l:DocumentCache::getTaggedJson (); are
+   * rethrown by `std::shared_future::get()`.
+   */
+  std::shared_future<std::shared_ptr<Representation>> renderTaggedJsonAsync(const oatpp::String& tags) const;
+
+};
+
+}}
+
+#endif /* oatpp_swagger_DocumentCache_hpp */
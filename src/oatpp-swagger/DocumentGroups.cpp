@@ -0,0 +1,169 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "DocumentGroups.hpp"
+
+#include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+
+#include <cstring>
+#include <string>
+
+namespace oatpp { namespace swagger {
+
+namespace {
+
+  /*
+   * Document url in index.html shipped in oatpp-swagger/res folder.
+   */
+  const char* const INDEX_DOCUMENT_URL = "url: \"/api-docs/oas-3.0.0.json\"";
+
+}
+
+DocumentGroups::DocumentGroups(const std::shared_ptr<ControllerConfig>& config,
+                               const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper)
+  : m_objectMapper(objectMapper)
+  , m_config(std::make_shared<ControllerConfig>(config ? *config : ControllerConfig()))
+{
+
+  // all groups go through the same generator. Config settings are applied to it here, once, so that publishers
+  // of the groups don't make copies of their own
+  m_config->generator = DocumentPublisher::createGenerator(m_config);
+
+  if(!m_objectMapper) {
+
+    auto serializerConfig = oatpp::parser::json::mapping::Serializer::Config::createShared();
+    serializerConfig->includeNullFields = false;
+
+    auto deserializerConfig = oatpp::parser::json::mapping::Deserializer::Config::createShared();
+    deserializerConfig->allowUnknownFields = false;
+
+    m_objectMapper = oatpp::parser::json::mapping::ObjectMapper::createShared(serializerConfig, deserializerConfig);
+
+  }
+
+}
+
+bool DocumentGroups::isValidName(const oatpp::String& name) {
+  if(!name || name->getSize() == 0) {
+    return false;
+  }
+  auto data = name->getData();
+  for(v_buff_size i = 0; i < name->getSize(); i ++) {
+    v_char8 a = data[i];
+    if(!((a >= 'a' && a <= 'z') || (a >= 'A' && a <= 'Z') || (a >= '0' && a <= '9') || a == '-' || a == '_')) {
+      return false;
+    }
+  }
+  return true;
+}
+
+DocumentGroups& DocumentGroups::addGroup(const oatpp::String& name,
+                                         const std::shared_ptr<DocumentInfo>& documentInfo,
+                                         const std::shared_ptr<Endpoints>& endpoints)
+{
+
+  OATPP_ASSERT(isValidName(name) && "[oatpp::swagger::DocumentGroups::addGroup()]: Error. Invalid group name.");
+  OATPP_ASSERT(m_publishers.find(name) == m_publishers.end() && "[oatpp::swagger::DocumentGroups::addGroup()]: Error. Group already exists.");
+
+  auto publisher = DocumentPublisher::createShared(m_objectMapper, documentInfo, m_config, nullptr);
+  if(m_config->deferGeneration) {
+    publisher->generateInBackground(endpoints);
+  } else {
+    publisher->regenerate(endpoints);
+  }
+
+  m_names.push_back(name);
+  m_publishers[name] = publisher;
+
+  return *this;
+
+}
+
+std::shared_ptr<DocumentPublisher> DocumentGroups::getGroup(const oatpp::String& name) const {
+  if(!name) {
+    return nullptr;
+  }
+  auto it = m_publishers.find(name);
+  if(it != m_publishers.end()) {
+    return it->second;
+  }
+  return nullptr;
+}
+
+const std::vector<oatpp::String>& DocumentGroups::getGroupNames() const {
+  return m_names;
+}
+
+bool DocumentGroups::regenerate(const oatpp::String& name, const std::shared_ptr<Endpoints>& endpoints) {
+  auto publisher = getGroup(name);
+  OATPP_ASSERT(publisher && "[oatpp::swagger::DocumentGroups::regenerate()]: Error. Unknown group.");
+  return publisher->regenerate(endpoints);
+}
+
+std::shared_ptr<oatpp::data::mapping::ObjectMapper> DocumentGroups::getObjectMapper() const {
+  return m_objectMapper;
+}
+
+oatpp::String DocumentGroups::getGroupName(const oatpp::String& filename, const char* extension) {
+  if(!filename) {
+    return nullptr;
+  }
+  v_buff_size extensionSize = (v_buff_size) std::strlen(extension);
+  v_buff_size size = filename->getSize();
+  if(size <= extensionSize || std::memcmp(filename->getData() + size - extensionSize, extension, extensionSize) != 0) {
+    return nullptr;
+  }
+  return oatpp::String((const char*) filename->getData(), size - extensionSize, true);
+}
+
+oatpp::String DocumentGroups::rewriteIndexHtml(const oatpp::String& indexHtml) const {
+
+  std::string result((const char*) indexHtml->getData(), indexHtml->getSize());
+
+  auto pos = result.find(INDEX_DOCUMENT_URL);
+  if(pos == std::string::npos) {
+    OATPP_LOGW("[oatpp::swagger::DocumentGroups::rewriteIndexHtml()]", "Warning. Document url not found in index.html. index.html is left as-is.");
+    return indexHtml;
+  }
+
+  // group names are validated in addGroup() so they need no escaping
+  std::string urls = "urls: [";
+  for(size_t i = 0; i < m_names.size(); i ++) {
+    if(i > 0) {
+      urls += ", ";
+    }
+    urls += "{url: \"/api-docs/";
+    urls += m_names[i]->c_str();
+    urls += ".json\", name: \"";
+    urls += m_names[i]->c_str();
+    urls += "\"}";
+  }
+  urls += "]";
+
+  result.replace(pos, std::strlen(INDEX_DOCUMENT_URL), urls);
+  return oatpp::String(result.data(), (v_buff_size) result.size(), true);
+
+}
+
+}}
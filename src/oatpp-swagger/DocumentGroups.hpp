@@ -0,0 +1,136 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_swagger_DocumentGroups_hpp
+#define oatpp_swagger_DocumentGroups_hpp
+
+#include "oatpp-swagger/DocumentPublisher.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+namespace oatpp { namespace swagger {
+
+/**
+ * Named groups of endpoints, each documented by its own &id:oatpp::swagger::DocumentInfo; (ex.: "public", "partner", "internal"). <br>
+ * Each group has its own &id:oatpp::swagger::DocumentPublisher;, so group documents are generated, cached and regenerated
+ * independently. Groups share one &id:oatpp::swagger::oas3::Generator;, so schemas of types used by several groups are generated once. <br>
+ * Pass DocumentGroups to &id:oatpp::swagger::Controller::createShared; or &id:oatpp::swagger::AsyncController::createShared;
+ * to serve group documents at `/api-docs/{group}.json` and list them in the Swagger-UI dropdown. <br>
+ * Groups should be added before the controller is created.
+ */
+class DocumentGroups {
+public:
+  typedef DocumentPublisher::Endpoints Endpoints;
+private:
+  static bool isValidName(const oatpp::String& name);
+private:
+  std::shared_ptr<oatpp::data::mapping::ObjectMapper> m_objectMapper;
+  std::shared_ptr<ControllerConfig> m_config;
+  std::vector<oatpp::String> m_names;
+  std::unordered_map<oatpp::String, std::shared_ptr<DocumentPublisher>> m_publishers;
+public:
+
+  /**
+   * Constructor.
+   * @param config - &id:oatpp::swagger::ControllerConfig; applied to all groups.
+   * @param objectMapper - &id:oatpp::data::mapping::ObjectMapper; used to serialize documents.
+   * `nullptr` - use JSON object mapper configured the same way as in &id:oatpp::swagger::Controller::createShared;.
+   */
+  DocumentGroups(const std::shared_ptr<ControllerConfig>& config = ControllerConfig::createShared(),
+                 const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper = nullptr);
+public:
+
+  /**
+   * Create shared DocumentGroups.
+   * @param config - &id:oatpp::swagger::ControllerConfig; applied to all groups.
+   * @param objectMapper - &id:oatpp::data::mapping::ObjectMapper; used to serialize documents. May be `nullptr`.
+   * @return - `std::shared_ptr` to DocumentGroups.
+   */
+  static std::shared_ptr<DocumentGroups> createShared(const std::shared_ptr<ControllerConfig>& config = ControllerConfig::createShared(),
+                                                      const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper = nullptr)
+  {
+    return std::make_shared<DocumentGroups>(config, objectMapper);
+  }
+
+  /**
+   * Add group and generate its document (on a background thread if &id:oatpp::swagger::ControllerConfig::deferGeneration; is set). <br>
+   * The first added group is the default one - it is also served at `/api-docs/oas-3.0.0.json`.
+   * @param name - group name. Used in url, so it may contain only latin letters, digits, `-` and `_`.
+   * @param documentInfo - &id:oatpp::swagger::DocumentInfo; of the group document.
+   * @param endpoints - &l:DocumentGroups::Endpoints; of the group.
+   * @return - this DocumentGroups.
+   */
+  DocumentGroups& addGroup(const oatpp::String& name,
+                           const std::shared_ptr<DocumentInfo>& documentInfo,
+                           const std::shared_ptr<Endpoints>& endpoints);
+
+  /**
+   * Get &id:oatpp::swagger::DocumentPublisher; of the group.
+   * @param name - group name.
+   * @return - `std::shared_ptr` to &id:oatpp::swagger::DocumentPublisher;. `nullptr` if there is no such group.
+   */
+  std::shared_ptr<DocumentPublisher> getGroup(const oatpp::String& name) const;
+
+  /**
+   * Get names of all groups in the order they were added.
+   * @return - group names.
+   */
+  const std::vector<oatpp::String>& getGroupNames() const;
+
+  /**
+   * Regenerate document of a single group. Other groups are not affected.
+   * See &id:oatpp::swagger::DocumentPublisher::regenerate;.
+   * @param name - group name.
+   * @param endpoints - updated &l:DocumentGroups::Endpoints; of the group.
+   * @return - `true` if the document was generated by this call, `false` if the request was coalesced into a running pass.
+   */
+  bool regenerate(const oatpp::String& name, const std::shared_ptr<Endpoints>& endpoints);
+
+  /**
+   * Get &id:oatpp::data::mapping::ObjectMapper; used to serialize documents.
+   * @return - `std::shared_ptr` to &id:oatpp::data::mapping::ObjectMapper;.
+   */
+  std::shared_ptr<oatpp::data::mapping::ObjectMapper> getObjectMapper() const;
+
+  /**
+   * Get group name from the file name of the group document.
+   * @param filename - file name. Ex.: `public.json`.
+   * @param extension - expected extension. Ex.: `.json`.
+   * @return - group name or `nullptr` if file name doesn't have the extension.
+   */
+  static oatpp::String getGroupName(const oatpp::String& filename, const char* extension);
+
+  /**
+   * Make Swagger-UI `index.html` list documents of all groups in the url dropdown.
+   * @param indexHtml - content of `index.html` shipped in oatpp-swagger/res folder.
+   * @return - rewritten `index.html`.
+   */
+  oatpp::String rewriteIndexHtml(const oatpp::String& indexHtml) const;
+
+};
+
+}}
+
+#endif /* oatpp_swagger_DocumentGroups_hpp */
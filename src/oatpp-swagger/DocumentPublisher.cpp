@@ -0,0 +1,303 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "DocumentPublisher.hpp"
+
+#include "oatpp-swagger/DocumentSnapshot.hpp"
+
+#include "oatpp/web/protocol/http/outgoing/ResponseFactory.hpp"
+#include "oatpp/core/utils/ConversionUtils.hpp"
+
+namespace oatpp { namespace swagger {
+
+DocumentPublisher::DocumentPublisher(const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper,
+                                     const std::shared_ptr<DocumentInfo>& documentInfo,
+                                     const std::shared_ptr<ControllerConfig>& config,
+                                     const std::shared_ptr<DocumentCache>& documentCache)
+  : m_objectMapper(objectMapper)
+  , m_documentInfo(documentInfo)
+  , m_config(config)
+  , m_documentCache(documentCache)
+  , m_generator(createGenerator(config))
+  , m_generating(false)
+  , m_failed(false)
+{}
+
+DocumentPublisher::~DocumentPublisher() {
+  if(m_backgroundThread.joinable()) {
+    m_backgroundThread.join();
+  }
+}
+
+std::shared_ptr<oas3::Generator> DocumentPublisher::createGenerator(const std::shared_ptr<ControllerConfig>& config) {
+
+  if(!config) {
+    return oas3::Generator::createShared();
+  }
+
+  auto generator = config->generator;
+  bool applyArena = config->arenaAllocation && !(generator && generator->isUseArena());
+  bool applyDeduplicate = config->deduplicateComponents && !(generator && generator->isDeduplicate());
+  bool applyOrder = config->documentOrder != oas3::Generator::ORDER_REGISTRATION &&
+                    !(generator && generator->getOrder() == config->documentOrder);
+
+  if(generator && !applyArena && !applyDeduplicate && !applyOrder) {
+    return generator;
+  }
+
+  generator = generator ? generator->createCopy() : oas3::Generator::createShared();
+  if(applyArena) {
+    generator->setUseArena(true);
+  }
+  if(applyDeduplicate) {
+    generator->setDeduplicate(true);
+  }
+  if(applyOrder) {
+    generator->setOrder(config->documentOrder);
+  }
+
+  return generator;
+
+}
+
+std::shared_ptr<DocumentCache> DocumentPublisher::getDocumentCache() const {
+  return std::atomic_load(&m_documentCache);
+}
+
+void DocumentPublisher::publish(const std::shared_ptr<DocumentCache>& documentCache) {
+  std::atomic_store(&m_documentCache, documentCache);
+}
+
+bool DocumentPublisher::regenerate(const std::shared_ptr<Endpoints>& endpoints) {
+
+  OATPP_ASSERT(m_documentInfo && "[oatpp::swagger::DocumentPublisher::regenerate()]: Error. DocumentInfo is not set.");
+
+  {
+    std::lock_guard<std::mutex> lock(m_lock);
+    m_pendingEndpoints = endpoints;
+    if(m_generating) {
+      return false;
+    }
+    m_generating = true;
+  }
+
+  while(true) {
+
+    std::shared_ptr<Endpoints> currEndpoints;
+
+    {
+      std::lock_guard<std::mutex> lock(m_lock);
+      if(!m_pendingEndpoints) {
+        m_generating = false;
+        return true;
+      }
+      currEndpoints = m_pendingEndpoints;
+      m_pendingEndpoints = nullptr;
+    }
+
+    try {
+      std::lock_guard<std::mutex> generateLock(m_generateLock);
+      auto allEndpoints = withExtendedEndpoints(currEndpoints);
+      publish(createDocumentCache(allEndpoints));
+      m_endpoints = allEndpoints;
+      m_failed = false;
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(m_lock);
+      m_pendingEndpoints = nullptr;
+      m_generating = false;
+      m_failed = true;
+      throw;
+    }
+
+  }
+
+}
+
+std::shared_ptr<DocumentPublisher::Endpoints> DocumentPublisher::withExtendedEndpoints(const std::shared_ptr<Endpoints>& endpoints) {
+
+  if(!m_extendedEndpoints || m_extendedEndpoints->count() == 0) {
+    return endpoints;
+  }
+
+  auto result = Endpoints::createShared();
+  std::unordered_set<Endpoint*> added;
+
+  auto curr = endpoints->getFirstNode();
+  while (curr != nullptr) {
+    if(added.insert(curr->getData().get()).second) {
+      result->pushBack(curr->getData());
+    }
+    curr = curr->getNext();
+  }
+
+  curr = m_extendedEndpoints->getFirstNode();
+  while (curr != nullptr) {
+    if(added.insert(curr->getData().get()).second) {
+      result->pushBack(curr->getData());
+    }
+    curr = curr->getNext();
+  }
+
+  return result;
+
+}
+
+oatpp::String DocumentPublisher::computeFingerprint(const std::shared_ptr<Endpoints>& endpoints) const {
+  // suffixes follow the effective settings - generator may have them enabled regardless of the config
+  auto fingerprint = oas3::Generator::computeFingerprint(m_documentInfo, endpoints);
+  if(m_generator->isDeduplicate()) {
+    fingerprint = fingerprint + "-deduplicated";
+  }
+  if(m_generator->getOrder() == oas3::Generator::ORDER_SORTED) {
+    fingerprint = fingerprint + "-sorted";
+  }
+  return fingerprint;
+}
+
+oatpp::String DocumentPublisher::serializeDocument(const oas3::Document::ObjectWrapper& document) {
+  auto fragments = std::atomic_load(&m_fragments);
+  if(fragments && !(m_config && m_config->streamDocument)) {
+    return DocumentStream::serialize(m_objectMapper, document, *fragments, m_config && m_config->useJsonWriter);
+  }
+  return nullptr; // let DocumentCache serialize it
+}
+
+std::shared_ptr<DocumentCache> DocumentPublisher::createDocumentCache(const std::shared_ptr<Endpoints>& endpoints) {
+
+  oatpp::String fingerprint;
+  if(m_config && (m_config->snapshotDir || m_config->streamDocument)) {
+    fingerprint = computeFingerprint(endpoints);
+  }
+
+  if(!m_config || !m_config->snapshotDir) {
+    auto document = m_generator->generate(m_documentInfo, endpoints, m_config ? m_config->generatorThreads : 1);
+    return DocumentCache::createShared(m_objectMapper, document, m_config, serializeDocument(document), fingerprint);
+  }
+
+  auto json = DocumentSnapshot::load(m_config->snapshotDir, fingerprint);
+  if(json) {
+    try {
+      auto document = m_objectMapper->readFromString<oas3::Document>(json);
+      if(document) {
+        return DocumentCache::createShared(m_objectMapper, document, m_config, serializeDocument(document), fingerprint);
+      }
+    } catch (std::exception& e) {
+      OATPP_LOGW("[oatpp::swagger::DocumentPublisher::createDocumentCache()]", "Warning. Snapshot is corrupted, regenerating: %s", e.what());
+    }
+  }
+
+  auto document = m_generator->generate(m_documentInfo, endpoints, m_config->generatorThreads);
+  auto documentCache = DocumentCache::createShared(m_objectMapper, document, m_config, serializeDocument(document), fingerprint);
+
+  auto documentJson = documentCache->getJson();
+  DocumentSnapshot::store(m_config->snapshotDir, fingerprint, documentJson ? documentJson->getBody() : m_objectMapper->writeToString(document));
+
+  return documentCache;
+
+}
+
+bool DocumentPublisher::extend(const std::shared_ptr<Endpoints>& endpoints) {
+
+  OATPP_ASSERT(m_documentInfo && "[oatpp::swagger::DocumentPublisher::extend()]: Error. DocumentInfo is not set.");
+
+  std::lock_guard<std::mutex> lock(m_generateLock);
+
+  if(!m_extendedEndpoints) {
+    m_extendedEndpoints = Endpoints::createShared();
+  }
+  auto curr = endpoints->getFirstNode();
+  while (curr != nullptr) {
+    m_extendedEndpoints->pushBack(curr->getData());
+    curr = curr->getNext();
+  }
+
+  auto documentCache = getDocumentCache();
+  if(!documentCache || !documentCache->getDocument()) {
+    return false;
+  }
+
+  if(!m_fragments) {
+    std::atomic_store(&m_fragments, std::make_shared<DocumentStream::Fragments>());
+  }
+
+  // order of extended document may differ from the one of full generation with the same inputs - it gets its own ETag
+  oatpp::String fingerprint;
+  if(m_endpoints) {
+    m_endpoints = withExtendedEndpoints(m_endpoints);
+    if(m_config && m_config->streamDocument) {
+      fingerprint = computeFingerprint(m_endpoints) + "-extended";
+    }
+  }
+
+  auto document = m_generator->extend(m_documentInfo, documentCache->getDocument(), endpoints, m_config ? m_config->generatorThreads : 1);
+  publish(DocumentCache::createShared(m_objectMapper, document, m_config, serializeDocument(document), fingerprint));
+
+  return true;
+
+}
+
+std::shared_ptr<oas3::Generator> DocumentPublisher::getGenerator() const {
+  return m_generator;
+}
+
+void DocumentPublisher::generateInBackground(const std::shared_ptr<Endpoints>& endpoints) {
+
+  OATPP_ASSERT(!m_backgroundThread.joinable() && "[oatpp::swagger::DocumentPublisher::generateInBackground()]: Error. Background generation was already started.");
+
+  m_backgroundThread = std::thread([this, endpoints] {
+    try {
+      regenerate(endpoints);
+    } catch (std::exception& e) {
+      OATPP_LOGE("[oatpp::swagger::DocumentPublisher::generateInBackground()]", "Error. Document generation failed: %s", e.what());
+    } catch (...) {
+      OATPP_LOGE("[oatpp::swagger::DocumentPublisher::generateInBackground()]", "Error. Document generation failed.");
+    }
+  });
+
+}
+
+bool DocumentPublisher::isReady() const {
+  return getDocumentCache() != nullptr;
+}
+
+DocumentPublisher::State DocumentPublisher::getState() const {
+  if(getDocumentCache()) {
+    return STATE_READY;
+  }
+  return m_failed ? STATE_FAILED : STATE_PENDING;
+}
+
+std::shared_ptr<DocumentPublisher::OutgoingResponse> DocumentPublisher::createNotReadyResponse() const {
+  if(getState() == STATE_FAILED) {
+    return oatpp::web::protocol::http::outgoing::ResponseFactory::createResponse(oatpp::web::protocol::http::Status::CODE_500,
+                                                                               "API document generation failed");
+  }
+  auto response = oatpp::web::protocol::http::outgoing::ResponseFactory::createResponse(oatpp::web::protocol::http::Status::CODE_503,
+                                                                                        "API document is being generated");
+  v_int32 retryAfter = m_config ? m_config->retryAfter : 1;
+  response->putHeader("Retry-After", oatpp::utils::conversion::int32ToStr(retryAfter));
+  return response;
+}
+
+}}
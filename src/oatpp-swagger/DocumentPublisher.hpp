@@ -0,0 +1,230 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_swagger_DocumentPublisher_hpp
+#define oatpp_swagger_DocumentPublisher_hpp
+
+#include "oatpp-swagger/DocumentCache.hpp"
+#include "oatpp-swagger/Model.hpp"
+#include "oatpp-swagger/oas3/Generator.hpp"
+
+#include "oatpp/web/server/api/Endpoint.hpp"
+#include "oatpp/core/collection/LinkedList.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+namespace oatpp { namespace swagger {
+
+/**
+ * Holds the current &id:oatpp::swagger::DocumentCache; of a controller and allows to replace it at runtime. <br>
+ * The current snapshot is published with an atomic pointer swap (RCU-style): readers take the snapshot
+ * without waiting for generation, and requests in flight keep using the snapshot they started with. <br>
+ * Concurrent calls to &l:DocumentPublisher::regenerate (); are coalesced - while a generation pass is running,
+ * new requests only replace the pending endpoints list, which is picked up by the running pass once it is done. <br>
+ * Initial document may be generated on a background thread - see &l:DocumentPublisher::generateInBackground ();. <br>
+ * All generations go through the same &id:oatpp::swagger::oas3::Generator; instance, so schemas of types
+ * that were already seen are reused. <br>
+ * If &id:oatpp::swagger::ControllerConfig::snapshotDir; is set, document is loaded from the on-disk snapshot
+ * when inputs didn't change since it was written (see &id:oatpp::swagger::DocumentSnapshot;).
+ */
+class DocumentPublisher {
+public:
+  typedef oatpp::web::server::api::Endpoint Endpoint;
+  typedef oatpp::collection::LinkedList<std::shared_ptr<Endpoint>> Endpoints;
+  typedef oatpp::web::protocol::http::outgoing::Response OutgoingResponse;
+public:
+
+  /**
+   * State of the published document.
+   */
+  enum State : v_int32 {
+
+    /**
+     * Document is not generated yet.
+     */
+    STATE_PENDING = 0,
+
+    /**
+     * Document is generated and served.
+     */
+    STATE_READY = 1,
+
+    /**
+     * Last generation pass failed and there is no document to serve.
+     */
+    STATE_FAILED = 2
+
+  };
+private:
+  std::shared_ptr<oatpp::data::mapping::ObjectMapper> m_objectMapper;
+  std::shared_ptr<DocumentInfo> m_documentInfo;
+  std::shared_ptr<ControllerConfig> m_config;
+  std::shared_ptr<DocumentCache> m_documentCache;
+  std::shared_ptr<oas3::Generator> m_generator;
+private:
+  std::mutex m_lock;
+  std::shared_ptr<Endpoints> m_pendingEndpoints;
+  bool m_generating;
+  std::atomic<bool> m_failed;
+  std::thread m_backgroundThread;
+private:
+  /*
+   * Held for the whole generation pass of regenerate() and for the whole extend(),
+   * so that a document is always generated from the complete list of endpoints.
+   */
+  std::mutex m_generateLock;
+  std::shared_ptr<Endpoints> m_extendedEndpoints;
+  std::shared_ptr<Endpoints> m_endpoints;
+  std::shared_ptr<DocumentStream::Fragments> m_fragments;
+private:
+  oatpp::String computeFingerprint(const std::shared_ptr<Endpoints>& endpoints) const;
+  oatpp::String serializeDocument(const oas3::Document::ObjectWrapper& document);
+  std::shared_ptr<Endpoints> withExtendedEndpoints(const std::shared_ptr<Endpoints>& endpoints);
+  std::shared_ptr<DocumentCache> createDocumentCache(const std::shared_ptr<Endpoints>& endpoints);
+public:
+
+  /**
+   * Constructor.
+   * @param objectMapper - &id:oatpp::data::mapping::ObjectMapper; used to serialize document.
+   * @param documentInfo - &id:oatpp::swagger::DocumentInfo;. May be `nullptr` if document is never regenerated.
+   * @param config - &id:oatpp::swagger::ControllerConfig;.
+   * @param documentCache - initial &id:oatpp::swagger::DocumentCache;. May be `nullptr` if document is generated later.
+   */
+  DocumentPublisher(const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper,
+                    const std::shared_ptr<DocumentInfo>& documentInfo,
+                    const std::shared_ptr<ControllerConfig>& config,
+                    const std::shared_ptr<DocumentCache>& documentCache);
+
+  /**
+   * Non-virtual Destructor. <br>
+   * Waits for background generation to finish.
+   */
+  ~DocumentPublisher();
+public:
+
+  /**
+   * Create shared DocumentPublisher.
+   * @param objectMapper - &id:oatpp::data::mapping::ObjectMapper; used to serialize document.
+   * @param documentInfo - &id:oatpp::swagger::DocumentInfo;. May be `nullptr` if document is never regenerated.
+   * @param config - &id:oatpp::swagger::ControllerConfig;.
+   * @param documentCache - initial &id:oatpp::swagger::DocumentCache;. May be `nullptr` if document is generated later.
+   * @return - `std::shared_ptr` to DocumentPublisher.
+   */
+  static std::shared_ptr<DocumentPublisher> createShared(const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper,
+                                                         const std::shared_ptr<DocumentInfo>& documentInfo,
+                                                         const std::shared_ptr<ControllerConfig>& config,
+                                                         const std::shared_ptr<DocumentCache>& documentCache)
+  {
+    return std::make_shared<DocumentPublisher>(objectMapper, documentInfo, config, documentCache);
+  }
+
+  /**
+   * Get generator configured with the settings of &id:oatpp::swagger::ControllerConfig; (arena allocation, deduplication, order). <br>
+   * Generator set in &id:oatpp::swagger::ControllerConfig::generator; may be shared with other controllers and exporters,
+   * so it is never modified - it is returned as-is if it already has these settings, otherwise settings are applied
+   * to its copy (see &id:oatpp::swagger::oas3::Generator::createCopy;).
+   * @param config - &id:oatpp::swagger::ControllerConfig;. May be `nullptr`.
+   * @return - `std::shared_ptr` to &id:oatpp::swagger::oas3::Generator;.
+   */
+  static std::shared_ptr<oas3::Generator> createGenerator(const std::shared_ptr<ControllerConfig>& config);
+
+  /**
+   * Get current snapshot.
+   * @return - `std::shared_ptr` to &id:oatpp::swagger::DocumentCache;. `nullptr` if document is not generated yet.
+   */
+  std::shared_ptr<DocumentCache> getDocumentCache() const;
+
+  /**
+   * Atomically replace current snapshot.
+   * @param documentCache - &id:oatpp::swagger::DocumentCache;.
+   */
+  void publish(const std::shared_ptr<DocumentCache>& documentCache);
+
+  /**
+   * Generate document for the given endpoints and publish it. <br>
+   * If another generation pass is running, endpoints are handed over to it and the call returns immediately. <br>
+   * Endpoints added with &l:DocumentPublisher::extend (); are kept in the document. <br>
+   * If generation throws, the pending endpoints are dropped, the failure is recorded (see &l:DocumentPublisher::getState ();)
+   * and the exception is rethrown.
+   * @param endpoints - &l:DocumentPublisher::Endpoints;.
+   * @return - `true` if the document was generated by this call, `false` if the request was coalesced into a running pass.
+   */
+  bool regenerate(const std::shared_ptr<Endpoints>& endpoints);
+
+  /**
+   * Add endpoints to the current document and publish the result. <br>
+   * Only the new endpoints and schemas which are not in the document yet are generated
+   * (see &id:oatpp::swagger::oas3::Generator::extend;), and only the new parts of the JSON document are serialized -
+   * serialized path items and schemas are kept since the first call to this method. Other renderings are created in full. <br>
+   * Calls to this method are mutually exclusive with each other and with generation passes of
+   * &l:DocumentPublisher::regenerate ();. Added endpoints are remembered and included by subsequent regenerations. <br>
+   * Previous snapshot is not modified - the new document shares its path items and schemas.
+   * @param endpoints - new &l:DocumentPublisher::Endpoints;.
+   * @return - `true` if document was extended. `false` if there is no document yet or it is not kept
+   * (see &id:oatpp::swagger::ControllerConfig::keepDocument;) - endpoints are then added by the next regeneration.
+   */
+  bool extend(const std::shared_ptr<Endpoints>& endpoints);
+
+  /**
+   * Get &id:oatpp::swagger::oas3::Generator; used by this publisher.
+   * @return - `std::shared_ptr` to &id:oatpp::swagger::oas3::Generator;.
+   */
+  std::shared_ptr<oas3::Generator> getGenerator() const;
+
+  /**
+   * Start &l:DocumentPublisher::regenerate (); on a background thread. <br>
+   * Should be called at most once. If generation fails, the error is logged and the state becomes
+   * &l:DocumentPublisher::STATE_FAILED;.
+   * @param endpoints - &l:DocumentPublisher::Endpoints;.
+   */
+  void generateInBackground(const std::shared_ptr<Endpoints>& endpoints);
+
+  /**
+   * Check if document was generated and is being served.
+   * @return - `true` if document is ready.
+   */
+  bool isReady() const;
+
+  /**
+   * Get state of the published document.
+   * @return - &l:DocumentPublisher::State;.
+   */
+  State getState() const;
+
+  /**
+   * Create response to be sent while document is not ready. <br>
+   * `503 Service Unavailable` with `Retry-After` header while document is being generated,
+   * `500 Internal Server Error` if generation failed (see &l:DocumentPublisher::STATE_FAILED;).
+   * @return - `std::shared_ptr` to &id:oatpp::web::protocol::http::outgoing::Response;.
+   */
+  std::shared_ptr<OutgoingResponse> createNotReadyResponse() const;
+
+};
+
+}}
+
+#endif /* oatpp_swagger_DocumentPublisher_hpp */
@@ -0,0 +1,110 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "DocumentSnapshot.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace oatpp { namespace swagger {
+
+const char* const DocumentSnapshot::FILE_NAME = "oas-3.0.0.snapshot";
+
+oatpp::String DocumentSnapshot::getFilePath(const oatpp::String& dir, const char* fileName) {
+  if(dir->getSize() > 0 && dir->getData()[dir->getSize() - 1] == '/') {
+    return dir + fileName;
+  }
+  return dir + "/" + fileName;
+}
+
+oatpp::String DocumentSnapshot::load(const oatpp::String& dir, const oatpp::String& fingerprint) {
+
+  auto path = getFilePath(dir, FILE_NAME);
+
+  std::ifstream file(path->c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+  if(!file.is_open()) {
+    return nullptr;
+  }
+
+  v_buff_size size = (v_buff_size) file.tellg();
+  v_buff_size headerSize = fingerprint->getSize() + 1;
+  if(size <= headerSize) {
+    return nullptr;
+  }
+
+  // check the fingerprint line before reading the whole document
+  oatpp::String header((v_int32) headerSize);
+  file.seekg(0, std::ios::beg);
+  file.read((char*) header->getData(), headerSize);
+  if(!file || std::memcmp(header->getData(), fingerprint->getData(), fingerprint->getSize()) != 0 || header->getData()[fingerprint->getSize()] != '\n') {
+    return nullptr;
+  }
+
+  oatpp::String result((v_int32) (size - headerSize));
+  file.read((char*) result->getData(), result->getSize());
+  if(!file) {
+    OATPP_LOGW("[oatpp::swagger::DocumentSnapshot::load()]", "Warning. Can't read snapshot '%s'.", path->c_str());
+    return nullptr;
+  }
+
+  return result;
+
+}
+
+bool DocumentSnapshot::store(const oatpp::String& dir, const oatpp::String& fingerprint, const oatpp::String& json) {
+
+  auto path = getFilePath(dir, FILE_NAME);
+  auto tmpPath = path + ".tmp";
+
+  {
+    std::ofstream file(tmpPath->c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if(file.is_open()) {
+      file.write((const char*) fingerprint->getData(), fingerprint->getSize());
+      file.put('\n');
+      file.write((const char*) json->getData(), json->getSize());
+      file.close();
+    }
+    if(!file) {
+      OATPP_LOGW("[oatpp::swagger::DocumentSnapshot::store()]", "Warning. Can't write snapshot '%s'.", tmpPath->c_str());
+      std::remove(tmpPath->c_str());
+      return false;
+    }
+  }
+
+#if defined(WIN32) || defined(_WIN32)
+  // rename() doesn't replace existing files on Windows
+  std::remove(path->c_str());
+#endif
+  if(std::rename(tmpPath->c_str(), path->c_str()) != 0) {
+    OATPP_LOGW("[oatpp::swagger::DocumentSnapshot::store()]", "Warning. Can't write snapshot '%s'.", path->c_str());
+    std::remove(tmpPath->c_str());
+    return false;
+  }
+
+  return true;
+
+}
+
+}}
@@ -0,0 +1,70 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_swagger_DocumentSnapshot_hpp
+#define oatpp_swagger_DocumentSnapshot_hpp
+
+#include "oatpp/core/Types.hpp"
+
+namespace oatpp { namespace swagger {
+
+/**
+ * On-disk snapshot of the serialized document keyed by fingerprint of the document inputs
+ * (see &id:oatpp::swagger::oas3::Generator::computeFingerprint;). <br>
+ * Snapshot file starts with the fingerprint line followed by the document JSON.
+ * Snapshot is written to a temporary file first and then renamed, so that concurrently starting processes
+ * never see a partially written snapshot.
+ */
+class DocumentSnapshot {
+public:
+  /**
+   * Name of the snapshot file.
+   */
+  static const char* const FILE_NAME;
+private:
+  static oatpp::String getFilePath(const oatpp::String& dir, const char* fileName);
+public:
+
+  /**
+   * Load document JSON from the snapshot.
+   * @param dir - snapshot directory.
+   * @param fingerprint - expected fingerprint.
+   * @return - document JSON or `nullptr` if there is no snapshot or its fingerprint doesn't match.
+   */
+  static oatpp::String load(const oatpp::String& dir, const oatpp::String& fingerprint);
+
+  /**
+   * Store document JSON to the snapshot replacing the previous one. Errors are logged and ignored.
+   * @param dir - snapshot directory. Must exist.
+   * @param fingerprint - fingerprint of the document inputs.
+   * @param json - document JSON.
+   * @return - `true` if snapshot was written.
+   */
+  static bool store(const oatpp::String& dir, const oatpp::String& fingerprint, const oatpp::String& json);
+
+};
+
+}}
+
+#endif /* oatpp_swagger_DocumentSnapshot_hpp */
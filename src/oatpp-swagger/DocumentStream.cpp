@@ -0,0 +1,248 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "DocumentStream.hpp"
+
+#include "oatpp-swagger/oas3/JsonWriter.hpp"
+
+#include <cstring>
+#include <utility>
+
+namespace oatpp { namespace swagger {
+
+DocumentStream::DocumentStream(const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper,
+                               const oas3::Document::ObjectWrapper& document,
+                               v_buff_size bufferSize,
+                               bool useJsonWriter)
+  : m_objectMapper(objectMapper)
+  , m_document(document)
+  , m_bufferSize(bufferSize)
+  , m_stage(STAGE_HEAD)
+  , m_currPath(nullptr)
+  , m_currSchema(nullptr)
+  , m_firstField(true)
+  , m_position(0)
+  , m_fragments(nullptr)
+  , m_useJsonWriter(useJsonWriter)
+{
+  OATPP_ASSERT(objectMapper && "[oatpp::swagger::DocumentStream::DocumentStream()]: Error. ObjectMapper should not be null.");
+  OATPP_ASSERT(document && "[oatpp::swagger::DocumentStream::DocumentStream()]: Error. Document should not be null.");
+}
+
+v_int64 DocumentStream::Fragments::getSize() {
+  std::lock_guard<std::mutex> lock(m_lock);
+  return m_fragments.size();
+}
+
+template<class Wrapper>
+std::string DocumentStream::serializeField(const oatpp::String& name, const Wrapper& value) {
+  if(m_useJsonWriter) {
+    std::string result;
+    oas3::JsonWriter::writeValue(result, name);
+    result += ':';
+    oas3::JsonWriter::writeValue(result, value);
+    return result;
+  }
+  // Serialize single-entry map and strip the braces - this way key is escaped
+  // and value is serialized exactly as the ObjectMapper does for the whole document.
+  auto field = oatpp::data::mapping::type::ListMap<String, Wrapper>::createShared();
+  field->put(name, value);
+  auto json = m_objectMapper->writeToString(field);
+  return std::string((const char*) json->getData() + 1, json->getSize() - 2);
+}
+
+void DocumentStream::appendField(const char* data, v_buff_size size) {
+  if(!m_firstField) {
+    m_buffer += ',';
+  }
+  m_firstField = false;
+  m_buffer.append(data, size);
+}
+
+template<class Wrapper>
+void DocumentStream::writeField(const oatpp::String& name, const Wrapper& value) {
+
+  if(!value) {
+    return; // consistent with includeNullFields == false
+  }
+
+  auto json = serializeField(name, value);
+  appendField(json.data(), json.size());
+
+}
+
+template<class Wrapper>
+void DocumentStream::writeFragment(const oatpp::String& name, const Wrapper& value) {
+
+  if(!m_fragments || !value) {
+    writeField(name, value);
+    return;
+  }
+
+  const void* object = value.getPtr().get();
+  auto& next = m_fragments->m_nextFragments[object];
+
+  auto it = m_fragments->m_fragments.find(object);
+  if(next.object && next.key == name) {
+    // same part is written twice in this document
+  } else if(it != m_fragments->m_fragments.end() && it->second.key == name) {
+    next = std::move(it->second);
+  } else {
+    next.object = value.getPtr();
+    next.key = name;
+    next.json = serializeField(name, value);
+  }
+
+  appendField(next.json.data(), next.json.size());
+
+}
+
+void DocumentStream::writeKey(const char* name) {
+  if(!m_firstField) {
+    m_buffer += ',';
+  }
+  m_buffer += '"';
+  m_buffer += name;
+  m_buffer += "\":{";
+  m_firstField = true;
+}
+
+bool DocumentStream::writeNextChunk() {
+
+  switch(m_stage) {
+
+    case STAGE_HEAD:
+      m_buffer += '{';
+      writeField("openapi", m_document->openapi);
+      writeField("info", m_document->info);
+      writeField("servers", m_document->servers);
+      if(m_document->paths) {
+        writeKey("paths");
+        m_currPath = m_document->paths->getFirstEntry();
+        m_stage = STAGE_PATHS;
+      } else {
+        m_stage = STAGE_COMPONENTS;
+      }
+      return true;
+
+    case STAGE_PATHS:
+      if(m_currPath != nullptr) {
+        writeFragment(m_currPath->getKey(), m_currPath->getValue());
+        m_currPath = m_currPath->getNext();
+      } else {
+        m_buffer += '}';
+        m_firstField = false;
+        m_stage = STAGE_COMPONENTS;
+      }
+      return true;
+
+    case STAGE_COMPONENTS:
+      if(m_document->components) {
+        writeKey("components");
+        if(m_document->components->schemas) {
+          writeKey("schemas");
+          m_currSchema = m_document->components->schemas->getFirstEntry();
+          m_stage = STAGE_SCHEMAS;
+        } else {
+          m_stage = STAGE_TAIL;
+        }
+      } else {
+        m_buffer += '}';
+        m_stage = STAGE_DONE;
+      }
+      return true;
+
+    case STAGE_SCHEMAS:
+      if(m_currSchema != nullptr) {
+        writeFragment(m_currSchema->getKey(), m_currSchema->getValue());
+        m_currSchema = m_currSchema->getNext();
+      } else {
+        m_buffer += '}';
+        m_firstField = false;
+        m_stage = STAGE_TAIL;
+      }
+      return true;
+
+    case STAGE_TAIL:
+      writeField("responses", m_document->components->responses);
+      writeField("securitySchemes", m_document->components->securitySchemes);
+      m_buffer += "}}";
+      m_stage = STAGE_DONE;
+      return true;
+
+    case STAGE_DONE:
+    default:
+      return false;
+
+  }
+
+}
+
+v_io_size DocumentStream::read(void *buffer, v_buff_size count, async::Action& action) {
+
+  (void) action;
+
+  if(m_position == (v_buff_size) m_buffer.size()) {
+    m_buffer.clear();
+    m_position = 0;
+    while((v_buff_size) m_buffer.size() < m_bufferSize && writeNextChunk()) {}
+    if(m_buffer.empty()) {
+      return 0;
+    }
+  }
+
+  v_buff_size size = (v_buff_size) m_buffer.size() - m_position;
+  if(size > count) {
+    size = count;
+  }
+
+  std::memcpy(buffer, m_buffer.data() + m_position, size);
+  m_position += size;
+
+  return size;
+
+}
+
+oatpp::String DocumentStream::serialize(const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper,
+                                       const oas3::Document::ObjectWrapper& document,
+                                       Fragments& fragments,
+                                       bool useJsonWriter)
+{
+
+  std::lock_guard<std::mutex> lock(fragments.m_lock);
+  fragments.m_nextFragments.clear();
+
+  DocumentStream stream(objectMapper, document, 0, useJsonWriter);
+  stream.m_fragments = &fragments;
+  while(stream.writeNextChunk()) {}
+
+  // fragments of parts which are not in this document anymore are dropped
+  fragments.m_fragments.swap(fragments.m_nextFragments);
+  fragments.m_nextFragments.clear();
+
+  return oatpp::String(stream.m_buffer.data(), (v_buff_size) stream.m_buffer.size(), true);
+
+}
+
+}}
@@ -0,0 +1,160 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_swagger_DocumentStream_hpp
+#define oatpp_swagger_DocumentStream_hpp
+
+#include "oatpp-swagger/oas3/Model.hpp"
+
+#include "oatpp/core/data/mapping/ObjectMapper.hpp"
+#include "oatpp/core/data/stream/Stream.hpp"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace oatpp { namespace swagger {
+
+/**
+ * Streams JSON of &id:oatpp::swagger::oas3::Document; path by path and component by component. <br>
+ * Each path item and each schema is serialized only when the previous chunk was consumed so memory
+ * used by the stream does not grow with the document size. <br>
+ * Output is byte-identical to the serialization of the whole document with the same &id:oatpp::data::mapping::ObjectMapper;.
+ */
+class DocumentStream : public oatpp::data::stream::ReadCallback {
+public:
+  typedef oatpp::data::mapping::type::ListMap<String, PathItem::ObjectWrapper> Paths;
+  typedef oatpp::data::mapping::type::ListMap<String, Schema::ObjectWrapper> Schemas;
+public:
+
+  /**
+   * Serialized path items and schemas of the last document passed to &l:DocumentStream::serialize ();. <br>
+   * Document parts are immutable and are shared between documents extended one from another
+   * (see &id:oatpp::swagger::oas3::Generator::extend;), so parts which are still present in the next document
+   * are not serialized again. Fragments hold the parts they were serialized from, so keys are never reused.
+   */
+  class Fragments {
+    friend DocumentStream;
+  private:
+    struct Fragment {
+      std::shared_ptr<void> object;
+      oatpp::String key;
+      std::string json;
+    };
+    typedef std::unordered_map<const void*, Fragment> FragmentMap;
+  private:
+    std::mutex m_lock;
+    FragmentMap m_fragments;
+    FragmentMap m_nextFragments;
+  public:
+
+    /**
+     * Get number of fragments.
+     * @return - number of fragments.
+     */
+    v_int64 getSize();
+
+  };
+
+private:
+
+  enum Stage : v_int32 {
+    STAGE_HEAD = 0,
+    STAGE_PATHS = 1,
+    STAGE_COMPONENTS = 2,
+    STAGE_SCHEMAS = 3,
+    STAGE_TAIL = 4,
+    STAGE_DONE = 5
+  };
+
+private:
+  std::shared_ptr<oatpp::data::mapping::ObjectMapper> m_objectMapper;
+  oas3::Document::ObjectWrapper m_document;
+  v_buff_size m_bufferSize;
+  Stage m_stage;
+  Paths::Entry* m_currPath;
+  Schemas::Entry* m_currSchema;
+  bool m_firstField;
+  std::string m_buffer;
+  v_buff_size m_position;
+  Fragments* m_fragments;
+  bool m_useJsonWriter;
+private:
+
+  template<class Wrapper>
+  std::string serializeField(const oatpp::String& name, const Wrapper& value);
+
+  template<class Wrapper>
+  void writeField(const oatpp::String& name, const Wrapper& value);
+
+  template<class Wrapper>
+  void writeFragment(const oatpp::String& name, const Wrapper& value);
+
+  void appendField(const char* data, v_buff_size size);
+
+  void writeKey(const char* name);
+  bool writeNextChunk();
+
+public:
+
+  /**
+   * Constructor.
+   * @param objectMapper - &id:oatpp::data::mapping::ObjectMapper; used to serialize document parts.
+   * @param document - &id:oatpp::swagger::oas3::Document;.
+   * @param bufferSize - approximate upper bound of buffered memory. Single path item or schema which is larger is buffered whole.
+   * @param useJsonWriter - serialize document parts with &id:oatpp::swagger::oas3::JsonWriter; instead of the `objectMapper`.
+   */
+  DocumentStream(const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper,
+                 const oas3::Document::ObjectWrapper& document,
+                 v_buff_size bufferSize,
+                 bool useJsonWriter = false);
+
+  /**
+   * Read next portion of the document.
+   * @param buffer - buffer to read data to.
+   * @param count - size of the buffer.
+   * @param action - async specific action. Stream never blocks so action is never set.
+   * @return - actual number of bytes read. `0` - end of document.
+   */
+  v_io_size read(void *buffer, v_buff_size count, async::Action& action) override;
+
+  /**
+   * Serialize whole document reusing serialized path items and schemas of the previous document. <br>
+   * Result is byte-identical to `objectMapper->writeToString(document)`.
+   * @param objectMapper - &id:oatpp::data::mapping::ObjectMapper; used to serialize document parts.
+   * @param document - &id:oatpp::swagger::oas3::Document;.
+   * @param fragments - &l:DocumentStream::Fragments;. Replaced by fragments of this document.
+   * @param useJsonWriter - serialize document parts with &id:oatpp::swagger::oas3::JsonWriter; instead of the `objectMapper`.
+   * @return - serialized document.
+   */
+  static oatpp::String serialize(const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper,
+                                 const oas3::Document::ObjectWrapper& document,
+                                 Fragments& fragments,
+                                 bool useJsonWriter = false);
+
+};
+
+}}
+
+#endif /* oatpp_swagger_DocumentStream_hpp */
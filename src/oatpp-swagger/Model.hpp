@@ -577,7 +577,7 @@ public:
      * @return
      */
     OAuthFlowBuilder& addScope(const String& name, const String& scope){
-      getScopes()->at(name) = scope;
+      (*getScopes())[name] = scope;
       return *this;
     }
 
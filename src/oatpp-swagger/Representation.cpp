@@ -0,0 +1,249 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "Representation.hpp"
+
+#include "oatpp/web/protocol/http/outgoing/ResponseFactory.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+namespace oatpp { namespace swagger {
+
+namespace {
+
+  /*
+   * 64-bit FNV-1a. Used to compute entity tags, not for security purposes.
+   */
+  v_uint64 hashBody(const oatpp::String& body) {
+    v_uint64 result = 14695981039346656037ULL;
+    auto data = body->getData();
+    for(v_buff_size i = 0; i < body->getSize(); i ++) {
+      result ^= data[i];
+      result *= 1099511628211ULL;
+    }
+    return result;
+  }
+
+  oatpp::String createETag(v_uint64 hash, v_buff_size size, const char* suffix) {
+    char buffer[64];
+    auto length = std::snprintf(buffer, sizeof(buffer), "\"%016llx-%llx%s\"",
+                                (unsigned long long) hash, (unsigned long long) size, suffix);
+    return oatpp::String(buffer, (v_buff_size) length, true);
+  }
+
+}
+
+Representation::Representation(const oatpp::String& contentType,
+                               const oatpp::String& body,
+                               const std::shared_ptr<ControllerConfig>& config)
+  : m_contentType(contentType)
+  , m_cacheControl(config ? config->cacheControl : nullptr)
+  , m_body(body)
+  , m_compress(false)
+  , m_compressionLevel(config ? config->compressionLevel : 0)
+{
+
+  OATPP_ASSERT(body && "[oatpp::swagger::Representation::Representation()]: Error. Body should not be null.");
+
+  m_hash = hashBody(m_body);
+  m_etag = createETag(m_hash, m_body->getSize(), "");
+
+  m_compress = config && config->enableCompression && body->getSize() >= config->compressionThreshold && Compression::isAvailable();
+
+  if(m_compress) {
+    m_gzip = createVariant(Compression::ENCODING_GZIP);
+    m_deflate = createVariant(Compression::ENCODING_DEFLATE);
+  }
+
+}
+
+v_uint64 Representation::getHash() const {
+  return m_hash;
+}
+
+bool Representation::matchETag(const oatpp::String& ifNoneMatch, const oatpp::String& etag) {
+
+  const char* data = ifNoneMatch->c_str();
+  v_buff_size size = ifNoneMatch->getSize();
+
+  v_buff_size pos = 0;
+  while(pos < size) {
+
+    while(pos < size && (data[pos] == ' ' || data[pos] == '\t' || data[pos] == ',')) pos ++;
+
+    // If-None-Match uses weak comparison
+    if(pos + 1 < size && data[pos] == 'W' && data[pos + 1] == '/') {
+      pos += 2;
+    }
+
+    v_buff_size tagStart = pos;
+    if(pos < size && data[pos] == '"') {
+      pos ++;
+      while(pos < size && data[pos] != '"') pos ++;
+      if(pos < size) pos ++;
+    } else {
+      while(pos < size && data[pos] != ',' && data[pos] != ' ' && data[pos] != '\t') pos ++;
+    }
+    v_buff_size tagSize = pos - tagStart;
+
+    if(tagSize == 1 && data[tagStart] == '*') {
+      return true;
+    }
+    if(tagSize == etag->getSize() && std::memcmp(data + tagStart, etag->getData(), tagSize) == 0) {
+      return true;
+    }
+
+    while(pos < size && data[pos] != ',') pos ++;
+
+  }
+
+  return false;
+
+}
+
+oatpp::String Representation::getContentType() const {
+  return m_contentType;
+}
+
+Representation::Variant Representation::createVariant(const char* encoding) const {
+
+  Variant result;
+
+  // keep variant only if it is actually smaller than the original
+  auto body = (encoding == Compression::ENCODING_GZIP) ? Compression::gzip(m_body, m_compressionLevel)
+                                                       : Compression::deflate(m_body, m_compressionLevel);
+  if(body && body->getSize() < m_body->getSize()) {
+    result.body = body;
+    // variants are different entities so each one has its own strong ETag
+    result.etag = createETag(getHash(), m_body->getSize(), (encoding == Compression::ENCODING_GZIP) ? "-gzip" : "-deflate");
+  }
+
+  return result;
+
+}
+
+bool Representation::isEncodingEnabled(const char* encoding) const {
+  return encoding == Compression::ENCODING_IDENTITY || m_compress;
+}
+
+oatpp::String Representation::getBody(const char* encoding) const {
+  if(std::strcmp(encoding, Compression::ENCODING_IDENTITY) == 0) {
+    return m_body;
+  } else if(!m_compress) {
+    return nullptr;
+  } else if(std::strcmp(encoding, Compression::ENCODING_GZIP) == 0) {
+    return m_gzip.body;
+  } else if(std::strcmp(encoding, Compression::ENCODING_DEFLATE) == 0) {
+    return m_deflate.body;
+  }
+  return nullptr;
+}
+
+oatpp::String Representation::getETag(const char* encoding) const {
+  if(std::strcmp(encoding, Compression::ENCODING_IDENTITY) == 0) {
+    return m_etag;
+  } else if(!m_compress) {
+    return nullptr;
+  } else if(std::strcmp(encoding, Compression::ENCODING_GZIP) == 0) {
+    return m_gzip.etag;
+  } else if(std::strcmp(encoding, Compression::ENCODING_DEFLATE) == 0) {
+    return m_deflate.etag;
+  }
+  return nullptr;
+}
+
+const char* Representation::negotiateEncoding(const oatpp::String& acceptEncoding) const {
+
+  // in order of preference when quality values are equal
+  const char* const encodings[] = {Compression::ENCODING_GZIP, Compression::ENCODING_DEFLATE, Compression::ENCODING_IDENTITY};
+  v_float64 qualities[3];
+
+  for(v_int32 i = 0; i < 3; i ++) {
+    qualities[i] = isEncodingEnabled(encodings[i]) ? Compression::getQuality(acceptEncoding, encodings[i]) : 0;
+  }
+
+  // fall back to the next coding if variant of the best one turned out not to be smaller
+  while(true) {
+
+    v_int32 best = -1;
+    v_float64 bestQuality = 0;
+    for(v_int32 i = 0; i < 3; i ++) {
+      if(qualities[i] > bestQuality) {
+        best = i;
+        bestQuality = qualities[i];
+      }
+    }
+
+    if(best < 0) {
+      return Compression::ENCODING_IDENTITY;
+    }
+    if(getBody(encodings[best])) {
+      return encodings[best];
+    }
+    qualities[best] = 0;
+
+  }
+
+}
+
+std::shared_ptr<Representation::OutgoingResponse> Representation::createResponse(const oatpp::String& acceptEncoding,
+                                                                                  const oatpp::String& ifNoneMatch) const
+{
+
+  typedef oatpp::web::protocol::http::Header Header;
+  typedef oatpp::web::protocol::http::Status Status;
+  typedef oatpp::web::protocol::http::outgoing::ResponseFactory ResponseFactory;
+
+  auto encoding = negotiateEncoding(acceptEncoding);
+  auto etag = getETag(encoding);
+
+  std::shared_ptr<OutgoingResponse> response;
+
+  if(ifNoneMatch && matchETag(ifNoneMatch, etag)) {
+    // no body and no content headers - only validators and caching headers of the selected variant
+    response = OutgoingResponse::createShared(Status::CODE_304, nullptr);
+  } else {
+    response = ResponseFactory::createResponse(Status::CODE_200, getBody(encoding));
+    response->putHeader(Header::CONTENT_TYPE, m_contentType);
+    if(encoding != Compression::ENCODING_IDENTITY) {
+      response->putHeader("Content-Encoding", encoding);
+    }
+  }
+
+  response->putHeader("ETag", etag);
+
+  if(m_cacheControl) {
+    response->putHeader("Cache-Control", m_cacheControl);
+  }
+
+  if(m_compress) {
+    response->putHeader("Vary", "Accept-Encoding");
+  }
+
+  return response;
+
+}
+
+}}
@@ -0,0 +1,143 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_swagger_Representation_hpp
+#define oatpp_swagger_Representation_hpp
+
+#include "oatpp-swagger/ControllerConfig.hpp"
+#include "oatpp-swagger/Compression.hpp"
+
+#include "oatpp/web/protocol/http/outgoing/Response.hpp"
+
+namespace oatpp { namespace swagger {
+
+/**
+ * Serialized rendering of the document together with its precompressed variants. <br>
+ * `ETag` and compressed variants are computed on construction, so serving a request never hashes
+ * or compresses anything. Representation is immutable and may be shared between threads.
+ */
+class Representation {
+public:
+  typedef oatpp::web::protocol::http::outgoing::Response OutgoingResponse;
+private:
+
+  /*
+   * Compressed variant. `body` is `nullptr` if variant is not smaller than the original.
+   */
+  struct Variant {
+    oatpp::String body;
+    oatpp::String etag;
+  };
+
+private:
+  Variant createVariant(const char* encoding) const;
+  v_uint64 getHash() const;
+  bool isEncodingEnabled(const char* encoding) const;
+private:
+  oatpp::String m_contentType;
+  oatpp::String m_cacheControl;
+  oatpp::String m_body;
+  bool m_compress;
+  v_int32 m_compressionLevel;
+  v_uint64 m_hash;
+  oatpp::String m_etag;
+private:
+  Variant m_gzip;
+  Variant m_deflate;
+public:
+
+  /**
+   * Constructor.
+   * @param contentType - value of `Content-Type` header.
+   * @param body - serialized document.
+   * @param config - &id:oatpp::swagger::ControllerConfig;.
+   */
+  Representation(const oatpp::String& contentType,
+                 const oatpp::String& body,
+                 const std::shared_ptr<ControllerConfig>& config);
+public:
+
+  /**
+   * Check if `If-None-Match` header matches the entity tag. Weak comparison is used as required for `If-None-Match`.
+   * @param ifNoneMatch - value of `If-None-Match` header.
+   * @param etag - quoted entity tag.
+   * @return - `true` if header lists the tag or is `*`.
+   */
+  static bool matchETag(const oatpp::String& ifNoneMatch, const oatpp::String& etag);
+
+  /**
+   * Create shared Representation.
+   * @param contentType - value of `Content-Type` header.
+   * @param body - serialized document.
+   * @param config - &id:oatpp::swagger::ControllerConfig;.
+   * @return - `std::shared_ptr` to Representation.
+   */
+  static std::shared_ptr<Representation> createShared(const oatpp::String& contentType,
+                                                      const oatpp::String& body,
+                                                      const std::shared_ptr<ControllerConfig>& config)
+  {
+    return std::make_shared<Representation>(contentType, body, config);
+  }
+
+  /**
+   * Get content type.
+   * @return - value of `Content-Type` header.
+   */
+  oatpp::String getContentType() const;
+
+  /**
+   * Get body encoded with the content coding.
+   * @param encoding - content coding. See &id:oatpp::swagger::Compression;.
+   * @return - encoded body or `nullptr` if there is no such variant.
+   */
+  oatpp::String getBody(const char* encoding = Compression::ENCODING_IDENTITY) const;
+
+  /**
+   * Get strong `ETag` of the body encoded with the content coding.
+   * @param encoding - content coding. See &id:oatpp::swagger::Compression;.
+   * @return - quoted entity tag or `nullptr` if there is no such variant.
+   */
+  oatpp::String getETag(const char* encoding = Compression::ENCODING_IDENTITY) const;
+
+  /**
+   * Choose best available content coding for the `Accept-Encoding` header.
+   * @param acceptEncoding - value of `Accept-Encoding` header. May be `nullptr`.
+   * @return - content coding. See &id:oatpp::swagger::Compression;.
+   */
+  const char* negotiateEncoding(const oatpp::String& acceptEncoding) const;
+
+  /**
+   * Create response carrying the best variant for the `Accept-Encoding` header. <br>
+   * If `If-None-Match` header matches `ETag` of the chosen variant then bodiless `304 Not Modified` is returned.
+   * @param acceptEncoding - value of `Accept-Encoding` header. May be `nullptr`.
+   * @param ifNoneMatch - value of `If-None-Match` header. May be `nullptr`.
+   * @return - `std::shared_ptr` to &id:oatpp::web::protocol::http::outgoing::Response;.
+   */
+  std::shared_ptr<OutgoingResponse> createResponse(const oatpp::String& acceptEncoding, const oatpp::String& ifNoneMatch) const;
+
+};
+
+}}
+
+#endif /* oatpp_swagger_Representation_hpp */
@@ -83,6 +83,14 @@ oatpp::String Resources::getResource(const oatpp::String& filename) {
                            );
 }
 
+oatpp::String Resources::readResource(const oatpp::String& filename) {
+  auto it = m_resources.find(filename);
+  if(it != m_resources.end()) {
+    return it->second;
+  }
+  return loadFromFile(filename->c_str());
+}
+
 std::shared_ptr<Resources::ReadCallback> Resources::getResourceStream(const oatpp::String &filename) {
   try {
     return std::make_shared<ReadCallback>(m_resDir + filename);
@@ -108,6 +108,13 @@ public:
    */
   oatpp::String getResource(const oatpp::String& filename);
 
+  /**
+   * Get resource content. Cached resource is returned if available, otherwise resource is read from disk.
+   * @param filename - name of the resource file.
+   * @return - &id:oatpp::String; containing resource binary data.
+   */
+  oatpp::String readResource(const oatpp::String& filename);
+
   /**
    * Get streamed resource by filename.
    * @param filename - name of the resource file.
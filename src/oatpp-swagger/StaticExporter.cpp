@@ -0,0 +1,253 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "StaticExporter.hpp"
+
+#include "oatpp-swagger/oas3/JsonWriter.hpp"
+
+#include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#if defined(WIN32) || defined(_WIN32)
+  #include <direct.h>
+#else
+  #include <sys/stat.h>
+#endif
+
+namespace oatpp { namespace swagger {
+
+namespace {
+
+  /*
+   * Swagger-UI files exported next to index.html. Same set as cached by Resources::loadResources().
+   */
+  const char* const UI_FILES[] = {
+    "favicon-16x16.png",
+    "favicon-32x32.png",
+    "oauth2-redirect.html",
+    "swagger-ui-bundle.js",
+    "swagger-ui-bundle.js.map",
+    "swagger-ui-standalone-preset.js",
+    "swagger-ui-standalone-preset.js.map",
+    "swagger-ui.css",
+    "swagger-ui.css.map",
+    "swagger-ui.js",
+    "swagger-ui.js.map"
+  };
+
+  /*
+   * Document url in index.html shipped in oatpp-swagger/res folder.
+   */
+  const char* const INDEX_DOCUMENT_URL = "/api-docs/oas-3.0.0.json";
+
+  bool isSourceMap(const std::string& fileName) {
+    return fileName.size() > 4 && fileName.compare(fileName.size() - 4, 4, ".map") == 0;
+  }
+
+}
+
+const char* const StaticExporter::JSON_FILE_NAME = "oas-3.0.0.json";
+const char* const StaticExporter::YAML_FILE_NAME = "oas-3.0.0.yaml";
+const char* const StaticExporter::LITE_JSON_FILE_NAME = "oas-3.0.0-lite.json";
+
+StaticExporter::StaticExporter(const std::shared_ptr<DocumentInfo>& documentInfo,
+                               const std::shared_ptr<ControllerConfig>& config,
+                               const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper)
+  : m_objectMapper(objectMapper)
+  , m_documentInfo(documentInfo)
+  , m_config(config ? config : ControllerConfig::createShared())
+{
+
+  OATPP_ASSERT(documentInfo && "[oatpp::swagger::StaticExporter::StaticExporter()]: Error. DocumentInfo should not be null.");
+
+  if(!m_objectMapper) {
+
+    auto serializerConfig = oatpp::parser::json::mapping::Serializer::Config::createShared();
+    serializerConfig->includeNullFields = false;
+
+    auto deserializerConfig = oatpp::parser::json::mapping::Deserializer::Config::createShared();
+    deserializerConfig->allowUnknownFields = false;
+
+    m_objectMapper = oatpp::parser::json::mapping::ObjectMapper::createShared(serializerConfig, deserializerConfig);
+
+  }
+
+}
+
+void StaticExporter::createDirectory(const oatpp::String& dir) {
+#if defined(WIN32) || defined(_WIN32)
+  auto res = _mkdir(dir->c_str());
+#else
+  auto res = mkdir(dir->c_str(), 0755);
+#endif
+  if(res != 0 && errno != EEXIST) {
+    OATPP_LOGE("[oatpp::swagger::StaticExporter::createDirectory()]", "Error. Can't create directory '%s'", dir->c_str());
+    throw std::runtime_error("[oatpp::swagger::StaticExporter::createDirectory()]: Can't create output directory.");
+  }
+}
+
+oatpp::String StaticExporter::getFilePath(const oatpp::String& dir, const char* fileName) {
+  if(dir->getSize() > 0 && dir->getData()[dir->getSize() - 1] == '/') {
+    return dir + fileName;
+  }
+  return dir + "/" + fileName;
+}
+
+void StaticExporter::writeFile(const oatpp::String& dir, const char* fileName, const oatpp::String& data) {
+
+  auto path = getFilePath(dir, fileName);
+
+  std::ofstream file(path->c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+  if(file.is_open()) {
+    file.write((const char*) data->getData(), data->getSize());
+    file.close();
+    if(file) {
+      return;
+    }
+  }
+
+  OATPP_LOGE("[oatpp::swagger::StaticExporter::writeFile()]", "Error. Can't write file '%s'", path->c_str());
+  throw std::runtime_error("[oatpp::swagger::StaticExporter::writeFile()]: Can't write file.");
+
+}
+
+void StaticExporter::writeRepresentation(const oatpp::String& dir,
+                                         const char* fileName,
+                                         const std::shared_ptr<Representation>& representation)
+{
+
+  writeFile(dir, fileName, representation->getBody());
+
+  // static file servers pick up precompressed ".gz" files (ex.: nginx gzip_static), there is no such convention for deflate.
+  auto gzipBody = representation->getBody(Compression::ENCODING_GZIP);
+  if(gzipBody) {
+    writeFile(dir, (std::string(fileName) + ".gz").c_str(), gzipBody);
+  }
+
+}
+
+oatpp::String StaticExporter::readFile(const oatpp::String& dir, const char* fileName, bool required) {
+
+  auto path = getFilePath(dir, fileName);
+
+  std::ifstream file(path->c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+  if(file.is_open()) {
+    auto result = oatpp::String((v_int32) file.tellg());
+    file.seekg(0, std::ios::beg);
+    file.read((char*) result->getData(), result->getSize());
+    file.close();
+    return result;
+  }
+
+  if(required) {
+    OATPP_LOGE("[oatpp::swagger::StaticExporter::readFile()]", "Error. Can't load file '%s'", path->c_str());
+    throw std::runtime_error("[oatpp::swagger::StaticExporter::readFile()]: Can't load file. Please make sure you specified full path to oatpp-swagger/res folder");
+  }
+
+  return nullptr;
+
+}
+
+void StaticExporter::exportDocument(const std::shared_ptr<Endpoints>& endpoints, const oatpp::String& outDir) {
+
+  createDirectory(outDir);
+
+  // exporter settings must not leak into the generator shared with controllers - use a private copy
+  auto generator = m_config->generator ? m_config->generator->createCopy() : oas3::Generator::createShared();
+  if(m_config->arenaAllocation) {
+    generator->setUseArena(true);
+  }
+  if(m_config->deduplicateComponents) {
+    generator->setDeduplicate(true);
+  }
+  if(m_config->documentOrder != oas3::Generator::ORDER_REGISTRATION) {
+    generator->setOrder(m_config->documentOrder);
+  }
+
+  auto document = generator->generate(m_documentInfo, endpoints, m_config->generatorThreads);
+  auto documentCache = DocumentCache::createShared(m_objectMapper, document, m_config);
+
+  auto json = documentCache->getJson();
+  if(!json) {
+    // config asks for streaming - there is nothing to stream to, serialize document as-is.
+    auto body = m_config->useJsonWriter ? oas3::JsonWriter::write(document) : m_objectMapper->writeToString(document);
+    json = Representation::createShared("application/json", body, m_config);
+  }
+  writeRepresentation(outDir, JSON_FILE_NAME, json);
+
+  if(documentCache->getYaml()) {
+    writeRepresentation(outDir, YAML_FILE_NAME, documentCache->getYaml());
+  }
+
+  if(documentCache->getLiteJson()) {
+    writeRepresentation(outDir, LITE_JSON_FILE_NAME, documentCache->getLiteJson());
+  }
+
+}
+
+void StaticExporter::exportUI(const oatpp::String& resDir, const oatpp::String& outDir, const oatpp::String& documentUrl) {
+
+  if(!resDir || resDir->getSize() == 0) {
+    throw std::runtime_error("[oatpp::swagger::StaticExporter::exportUI()]: Invalid resDir path. Please specify full path to oatpp-swagger/res folder");
+  }
+
+  createDirectory(outDir);
+
+  writeFile(outDir, "index.html", rewriteIndexHtml(readFile(resDir, "index.html", true), documentUrl));
+
+  for(const char* fileName : UI_FILES) {
+    auto data = readFile(resDir, fileName, !isSourceMap(fileName));
+    if(data) {
+      writeFile(outDir, fileName, data);
+    }
+  }
+
+}
+
+void StaticExporter::exportAll(const std::shared_ptr<Endpoints>& endpoints, const oatpp::String& resDir, const oatpp::String& outDir) {
+  exportDocument(endpoints, outDir);
+  exportUI(resDir, outDir);
+}
+
+oatpp::String StaticExporter::rewriteIndexHtml(const oatpp::String& indexHtml, const oatpp::String& documentUrl) {
+
+  std::string result((const char*) indexHtml->getData(), indexHtml->getSize());
+
+  auto pos = result.find(INDEX_DOCUMENT_URL);
+  if(pos == std::string::npos) {
+    OATPP_LOGW("[oatpp::swagger::StaticExporter::rewriteIndexHtml()]", "Warning. Document url not found in index.html. index.html is left as-is.");
+    return indexHtml;
+  }
+
+  result.replace(pos, std::strlen(INDEX_DOCUMENT_URL), documentUrl->c_str(), documentUrl->getSize());
+  return oatpp::String(result.data(), (v_buff_size) result.size(), true);
+
+}
+
+}}
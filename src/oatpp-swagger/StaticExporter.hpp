@@ -0,0 +1,146 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_swagger_StaticExporter_hpp
+#define oatpp_swagger_StaticExporter_hpp
+
+#include "oatpp-swagger/DocumentCache.hpp"
+#include "oatpp-swagger/Model.hpp"
+#include "oatpp-swagger/oas3/Generator.hpp"
+
+#include "oatpp/core/data/mapping/ObjectMapper.hpp"
+
+namespace oatpp { namespace swagger {
+
+/**
+ * Exports API document and Swagger-UI to a directory, so that documentation can be served as static files
+ * (ex.: from CDN) instead of by &id:oatpp::swagger::Controller;. <br>
+ * Output directory contains:
+ * <ul>
+ *   <li>`oas-3.0.0.json` - Open API Specification.</li>
+ *   <li>`oas-3.0.0.yaml` - YAML rendering. If &id:oatpp::swagger::ControllerConfig::enableYaml; is set.</li>
+ *   <li>`oas-3.0.0-lite.json` - document without free-text fields. If &id:oatpp::swagger::ControllerConfig::enableLite; is set.</li>
+ *   <li>`*.gz` - precompressed variants of the above. If compression is enabled and available
+ *   (see &id:oatpp::swagger::ControllerConfig::enableCompression;).</li>
+ *   <li>Swagger-UI files with `index.html` pointing to the exported `oas-3.0.0.json`.</li>
+ * </ul>
+ * Usually called from a dedicated build step of the application (ex.: `--export-docs` command line flag),
+ * so that production binary doesn't need to generate the document at all.
+ */
+class StaticExporter {
+public:
+  typedef oas3::Generator::Endpoints Endpoints;
+public:
+  /**
+   * File name of the exported JSON document.
+   */
+  static const char* const JSON_FILE_NAME;
+
+  /**
+   * File name of the exported YAML document.
+   */
+  static const char* const YAML_FILE_NAME;
+
+  /**
+   * File name of the exported "lite" JSON document.
+   */
+  static const char* const LITE_JSON_FILE_NAME;
+private:
+  static void createDirectory(const oatpp::String& dir);
+  static oatpp::String getFilePath(const oatpp::String& dir, const char* fileName);
+  static void writeFile(const oatpp::String& dir, const char* fileName, const oatpp::String& data);
+  static void writeRepresentation(const oatpp::String& dir, const char* fileName, const std::shared_ptr<Representation>& representation);
+  static oatpp::String readFile(const oatpp::String& dir, const char* fileName, bool required);
+private:
+  std::shared_ptr<oatpp::data::mapping::ObjectMapper> m_objectMapper;
+  std::shared_ptr<DocumentInfo> m_documentInfo;
+  std::shared_ptr<ControllerConfig> m_config;
+public:
+
+  /**
+   * Constructor.
+   * @param documentInfo - &id:oatpp::swagger::DocumentInfo;.
+   * @param config - &id:oatpp::swagger::ControllerConfig;.
+   * @param objectMapper - &id:oatpp::data::mapping::ObjectMapper; used to serialize document.
+   * `nullptr` - use JSON object mapper configured the same way as in &id:oatpp::swagger::Controller::createShared;.
+   */
+  StaticExporter(const std::shared_ptr<DocumentInfo>& documentInfo,
+                 const std::shared_ptr<ControllerConfig>& config = ControllerConfig::createShared(),
+                 const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper = nullptr);
+public:
+
+  /**
+   * Create shared StaticExporter.
+   * @param documentInfo - &id:oatpp::swagger::DocumentInfo;.
+   * @param config - &id:oatpp::swagger::ControllerConfig;.
+   * @param objectMapper - &id:oatpp::data::mapping::ObjectMapper; used to serialize document. May be `nullptr`.
+   * @return - `std::shared_ptr` to StaticExporter.
+   */
+  static std::shared_ptr<StaticExporter> createShared(const std::shared_ptr<DocumentInfo>& documentInfo,
+                                                      const std::shared_ptr<ControllerConfig>& config = ControllerConfig::createShared(),
+                                                      const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper = nullptr)
+  {
+    return std::make_shared<StaticExporter>(documentInfo, config, objectMapper);
+  }
+
+  /**
+   * Generate document and write its renderings to the output directory.
+   * @param endpoints - &l:StaticExporter::Endpoints;.
+   * @param outDir - output directory. Created if doesn't exist (parent directory must exist).
+   * @throws - `std::runtime_error` if file can't be written.
+   */
+  void exportDocument(const std::shared_ptr<Endpoints>& endpoints, const oatpp::String& outDir);
+
+  /**
+   * Copy Swagger-UI resources to the output directory. `index.html` is rewritten to load
+   * the document from `documentUrl`. Missing source maps are skipped.
+   * @param resDir - directory containing swagger-ui resources (oatpp-swagger/res folder).
+   * @param outDir - output directory. Created if doesn't exist (parent directory must exist).
+   * @param documentUrl - url of the document as seen by the browser. Default - exported `oas-3.0.0.json` next to `index.html`.
+   * @throws - `std::runtime_error` if required resource can't be read or file can't be written.
+   */
+  void exportUI(const oatpp::String& resDir, const oatpp::String& outDir, const oatpp::String& documentUrl = JSON_FILE_NAME);
+
+  /**
+   * Export document and Swagger-UI to the output directory.
+   * See &l:StaticExporter::exportDocument (); and &l:StaticExporter::exportUI ();.
+   * @param endpoints - &l:StaticExporter::Endpoints;.
+   * @param resDir - directory containing swagger-ui resources (oatpp-swagger/res folder).
+   * @param outDir - output directory. Created if doesn't exist (parent directory must exist).
+   */
+  void exportAll(const std::shared_ptr<Endpoints>& endpoints, const oatpp::String& resDir, const oatpp::String& outDir);
+
+  /**
+   * Point Swagger-UI `index.html` to the document url.
+   * @param indexHtml - content of `index.html` shipped in oatpp-swagger/res folder.
+   * @param documentUrl - url of the document.
+   * @return - rewritten `index.html`.
+   */
+  static oatpp::String rewriteIndexHtml(const oatpp::String& indexHtml, const oatpp::String& documentUrl);
+
+};
+
+}}
+
+#endif /* oatpp_swagger_StaticExporter_hpp */
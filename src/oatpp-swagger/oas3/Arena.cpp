@@ -0,0 +1,130 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "Arena.hpp"
+
+#include <cstdint>
+
+#include <cstdlib>
+#include <new>
+
+namespace oatpp { namespace swagger { namespace oas3 {
+
+namespace {
+
+  /*
+   * Arena taken by the thread from the pool it allocated from last time.
+   * Pool ids are never reused, so arena of a destroyed pool is never looked up.
+   */
+  struct ThreadArena {
+    v_uint64 poolId;
+    const std::shared_ptr<Arena>* arena;
+  };
+
+  thread_local ThreadArena CURRENT_ARENA = {0, nullptr};
+
+}
+
+std::atomic<v_int64> Arena::INSTANCES_COUNT(0);
+
+Arena::Arena(v_buff_size chunkSize)
+  : m_chunkSize(chunkSize)
+  , m_position(nullptr)
+  , m_available(0)
+  , m_allocatedSize(0)
+{
+  INSTANCES_COUNT ++;
+}
+
+Arena::~Arena() {
+  for(void* chunk : m_chunks) {
+    std::free(chunk);
+  }
+  INSTANCES_COUNT --;
+}
+
+void* Arena::allocate(v_buff_size size, v_buff_size alignment) {
+
+  v_buff_size padding = (alignment - ((v_buff_size) reinterpret_cast<std::uintptr_t>(m_position) & (alignment - 1))) & (alignment - 1);
+
+  if(m_position == nullptr || padding + size > m_available) {
+
+    // malloc memory is aligned for any fundamental type
+    v_buff_size chunkSize = size > m_chunkSize / 4 ? size : m_chunkSize;
+    void* chunk = std::malloc(chunkSize);
+    if(chunk == nullptr) {
+      throw std::bad_alloc();
+    }
+    m_chunks.push_back(chunk);
+    m_allocatedSize += chunkSize;
+
+    if(chunkSize != m_chunkSize) {
+      // large allocations get own chunk and do not interrupt the current one
+      return chunk;
+    }
+
+    m_position = (v_char8*) chunk;
+    m_available = chunkSize;
+    padding = 0;
+
+  }
+
+  void* result = m_position + padding;
+  m_position += padding + size;
+  m_available -= padding + size;
+  return result;
+
+}
+
+v_buff_size Arena::getAllocatedSize() const {
+  return m_allocatedSize;
+}
+
+v_int64 Arena::getInstancesCount() {
+  return INSTANCES_COUNT;
+}
+
+std::atomic<v_uint64> ArenaPool::NEXT_ID(1);
+
+ArenaPool::ArenaPool(v_buff_size chunkSize)
+  : m_id(NEXT_ID ++)
+  , m_chunkSize(chunkSize)
+{}
+
+const std::shared_ptr<Arena>& ArenaPool::getThreadArena() {
+
+  if(CURRENT_ARENA.poolId == m_id) {
+    return *CURRENT_ARENA.arena;
+  }
+
+  std::lock_guard<std::mutex> lock(m_lock);
+  // list nodes don't move - the thread keeps pointer to its arena
+  m_arenas.push_back(std::make_shared<Arena>(m_chunkSize));
+  CURRENT_ARENA.poolId = m_id;
+  CURRENT_ARENA.arena = &m_arenas.back();
+  return m_arenas.back();
+
+}
+
+}}}
@@ -0,0 +1,175 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_swagger_oas3_Arena_hpp
+#define oatpp_swagger_oas3_Arena_hpp
+
+#include "oatpp/core/base/Environment.hpp"
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace oatpp { namespace swagger { namespace oas3 {
+
+/**
+ * Monotonic memory arena. <br>
+ * Memory is taken from large chunks and is never returned to the arena - all chunks are freed at once
+ * when arena is destroyed. Allocation is not thread-safe - each thread allocates from its own arena of &l:ArenaPool;.
+ */
+class Arena {
+private:
+  static std::atomic<v_int64> INSTANCES_COUNT;
+private:
+  std::vector<void*> m_chunks;
+  v_buff_size m_chunkSize;
+  v_char8* m_position;
+  v_buff_size m_available;
+  v_buff_size m_allocatedSize;
+public:
+
+  /**
+   * Constructor.
+   * @param chunkSize - size of memory chunk.
+   */
+  Arena(v_buff_size chunkSize = 64 * 1024);
+
+  /**
+   * Non-virtual Destructor. Frees all chunks.
+   */
+  ~Arena();
+
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  /**
+   * Allocate memory.
+   * @param size - size in bytes.
+   * @param alignment - alignment. Power of two.
+   * @return - pointer to allocated memory.
+   */
+  void* allocate(v_buff_size size, v_buff_size alignment);
+
+  /**
+   * Get total size of chunks allocated by the arena.
+   * @return - size in bytes.
+   */
+  v_buff_size getAllocatedSize() const;
+
+  /**
+   * Get number of arenas which are not destroyed yet.
+   * @return - number of arenas.
+   */
+  static v_int64 getInstancesCount();
+
+};
+
+/**
+ * Arenas of a single document generation - one &l:Arena; per allocating thread. <br>
+ * Threads allocate from their arenas without locking, the pool is locked only when a thread takes its arena. <br>
+ * Pool may be destroyed before objects allocated from it - each arena lives as long as any object allocated in it
+ * (see &l:ArenaAllocator;).
+ */
+class ArenaPool {
+private:
+  static std::atomic<v_uint64> NEXT_ID;
+private:
+  v_uint64 m_id;
+  v_buff_size m_chunkSize;
+  std::mutex m_lock;
+  std::list<std::shared_ptr<Arena>> m_arenas;
+public:
+
+  /**
+   * Constructor.
+   * @param chunkSize - size of memory chunk of each arena.
+   */
+  ArenaPool(v_buff_size chunkSize = 64 * 1024);
+
+  ArenaPool(const ArenaPool&) = delete;
+  ArenaPool& operator=(const ArenaPool&) = delete;
+
+  /**
+   * Get arena of the calling thread. Arena is created on the first call from the thread.
+   * @return - &l:Arena;.
+   */
+  const std::shared_ptr<Arena>& getThreadArena();
+
+};
+
+/**
+ * STL allocator taking memory from &l:Arena;. `deallocate` is no-op. <br>
+ * Allocator holds `std::shared_ptr` to the arena, so when used with `std::allocate_shared`
+ * the arena lives as long as any object allocated in it.
+ * @tparam T - type of allocated objects.
+ */
+template<class T>
+class ArenaAllocator {
+  template<class U>
+  friend class ArenaAllocator;
+private:
+  std::shared_ptr<Arena> m_arena;
+public:
+  typedef T value_type;
+
+  template<class U>
+  struct rebind {
+    typedef ArenaAllocator<U> other;
+  };
+public:
+
+  explicit ArenaAllocator(const std::shared_ptr<Arena>& arena)
+    : m_arena(arena)
+  {}
+
+  template<class U>
+  ArenaAllocator(const ArenaAllocator<U>& other)
+    : m_arena(other.m_arena)
+  {}
+
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(m_arena->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* ptr, std::size_t n) {
+    // memory is freed together with the arena
+  }
+
+  template<class U>
+  bool operator==(const ArenaAllocator<U>& other) const {
+    return m_arena == other.m_arena;
+  }
+
+  template<class U>
+  bool operator!=(const ArenaAllocator<U>& other) const {
+    return m_arena != other.m_arena;
+  }
+
+};
+
+}}}
+
+#endif /* oatpp_swagger_oas3_Arena_hpp */
@@ -0,0 +1,673 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "Deduplicator.hpp"
+
+#include <cctype>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace oatpp { namespace swagger { namespace oas3 {
+
+namespace {
+
+  template <class Value>
+  using Fields = Deduplicator::Fields<Value>;
+
+  template <class Value>
+  using List = Deduplicator::List<Value>;
+
+  const char* const SCHEMA_REF_PREFIX = "#/components/schemas/";
+  const char* const RESPONSE_REF_PREFIX = "#/components/responses/";
+
+  // size of serialized `{"$ref":"<prefix>"}` without the component name
+  const v_int64 SCHEMA_REF_SIZE = 32;
+  const v_int64 RESPONSE_REF_SIZE = 34;
+
+  // max size of the component name derived from the response description
+  const std::string::size_type MAX_RESPONSE_NAME_SIZE = 64;
+
+  /*
+   * Canonical form of the document part. Same as JSON written by the object mapper,
+   * so that its size is the size of the part in the serialized document.
+   */
+
+  void writeString(std::string& out, const oatpp::String& value) {
+    out += '"';
+    auto data = value->getData();
+    for(v_buff_size i = 0; i < value->getSize(); i ++) {
+      auto c = data[i];
+      if(c == '"' || c == '\\') {
+        out += '\\';
+        out += (char) c;
+      } else if(c < 0x20) {
+        char buffer[8];
+        std::snprintf(buffer, sizeof(buffer), "\\u%04x", (unsigned) c);
+        out += buffer;
+      } else {
+        out += (char) c;
+      }
+    }
+    out += '"';
+  }
+
+  void writeKey(std::string& out, const char* key, bool& first) {
+    if(!first) {
+      out += ',';
+    }
+    first = false;
+    out += '"';
+    out += key;
+    out += "\":";
+  }
+
+  void writeSchema(std::string& out, const Schema::ObjectWrapper& schema) {
+
+    if(!schema) {
+      out += "null";
+      return;
+    }
+
+    bool first = true;
+    out += '{';
+
+    if(schema->type) {
+      writeKey(out, "type", first);
+      writeString(out, schema->type);
+    }
+
+    if(schema->format) {
+      writeKey(out, "format", first);
+      writeString(out, schema->format);
+    }
+
+    if(schema->properties) {
+      writeKey(out, "properties", first);
+      out += '{';
+      bool firstProperty = true;
+      auto curr = schema->properties->getFirstEntry();
+      while(curr != nullptr) {
+        if(!firstProperty) {
+          out += ',';
+        }
+        firstProperty = false;
+        writeString(out, curr->getKey());
+        out += ':';
+        writeSchema(out, curr->getValue());
+        curr = curr->getNext();
+      }
+      out += '}';
+    }
+
+    if(schema->items) {
+      writeKey(out, "items", first);
+      writeSchema(out, schema->items);
+    }
+
+    if(schema->additionalProperties) {
+      writeKey(out, "additionalProperties", first);
+      writeSchema(out, schema->additionalProperties);
+    }
+
+    if(schema->ref) {
+      writeKey(out, "$ref", first);
+      writeString(out, schema->ref);
+    }
+
+    out += '}';
+
+  }
+
+  void writeResponse(std::string& out, const OperationResponse::ObjectWrapper& response) {
+
+    if(!response) {
+      out += "null";
+      return;
+    }
+
+    bool first = true;
+    out += '{';
+
+    if(response->description) {
+      writeKey(out, "description", first);
+      writeString(out, response->description);
+    }
+
+    if(response->content) {
+      writeKey(out, "content", first);
+      out += '{';
+      bool firstMediaType = true;
+      auto curr = response->content->getFirstEntry();
+      while(curr != nullptr) {
+        if(!firstMediaType) {
+          out += ',';
+        }
+        firstMediaType = false;
+        writeString(out, curr->getKey());
+        out += ':';
+        auto mediaType = curr->getValue();
+        if(mediaType) {
+          out += '{';
+          if(mediaType->schema) {
+            out += "\"schema\":";
+            writeSchema(out, mediaType->schema);
+          }
+          out += '}';
+        } else {
+          out += "null";
+        }
+        curr = curr->getNext();
+      }
+      out += '}';
+    }
+
+    if(response->ref) {
+      writeKey(out, "$ref", first);
+      writeString(out, response->ref);
+    }
+
+    out += '}';
+
+  }
+
+  std::string getCanonical(const Schema::ObjectWrapper& schema) {
+    std::string result;
+    writeSchema(result, schema);
+    return result;
+  }
+
+  std::string getCanonical(const OperationResponse::ObjectWrapper& response) {
+    std::string result;
+    writeResponse(result, response);
+    return result;
+  }
+
+  /*
+   * Component names
+   */
+
+  void appendIdentifier(std::string& out, const char* data, v_buff_size size) {
+    bool upper = true;
+    for(v_buff_size i = 0; i < size; i ++) {
+      auto c = (unsigned char) data[i];
+      if(std::isalnum(c)) {
+        out += (char) (upper ? std::toupper(c) : c);
+        upper = false;
+      } else {
+        upper = true;
+      }
+    }
+  }
+
+  void appendIdentifier(std::string& out, const oatpp::String& text) {
+    if(text) {
+      appendIdentifier(out, (const char*) text->getData(), text->getSize());
+    }
+  }
+
+  std::string getBaseName(const Schema::ObjectWrapper& schema) {
+
+    std::string result;
+
+    if(schema->ref) {
+      auto data = (const char*) schema->ref->getData();
+      auto size = schema->ref->getSize();
+      auto start = size;
+      while(start > 0 && data[start - 1] != '/') {
+        start --;
+      }
+      appendIdentifier(result, data + start, size - start);
+    } else if(schema->items) {
+      result = getBaseName(schema->items) + "List";
+    } else if(schema->additionalProperties) {
+      result = getBaseName(schema->additionalProperties) + "Map";
+    } else if(schema->properties) {
+      result = "Object";
+    } else {
+      appendIdentifier(result, schema->type);
+      appendIdentifier(result, schema->format);
+    }
+
+    if(result.empty()) {
+      return "Schema";
+    }
+    return result;
+
+  }
+
+  std::string getBaseName(const OperationResponse::ObjectWrapper& response) {
+    std::string result;
+    appendIdentifier(result, response->description);
+    if(result.size() > MAX_RESPONSE_NAME_SIZE) {
+      result.resize(MAX_RESPONSE_NAME_SIZE);
+    }
+    if(result.empty()) {
+      return "Response";
+    }
+    return result;
+  }
+
+  std::string getFreeName(const std::unordered_set<std::string>& names, const std::string& baseName) {
+    std::string result = baseName;
+    v_int32 index = 2;
+    while(names.find(result) != names.end()) {
+      result = baseName + "_" + std::to_string(index ++);
+    }
+    return result;
+  }
+
+  /*
+   * Distinct parts of one kind in order of first occurrence.
+   */
+
+  template<class T>
+  struct Entry {
+    typename T::ObjectWrapper part;
+    v_int64 size;
+    v_int64 count;
+    bool existing;
+    oatpp::String name; // name of the new component. nullptr - part is not hoisted
+    typename T::ObjectWrapper ref; // replacement of occurrences. nullptr - occurrences stay inline
+  };
+
+  template<class T>
+  class Entries {
+  private:
+    std::unordered_map<std::string, size_t> m_index;
+    std::vector<Entry<T>> m_entries;
+    std::vector<size_t> m_occurrences;
+  private:
+
+    size_t getIndex(const typename T::ObjectWrapper& part) {
+      auto canonical = getCanonical(part);
+      auto it = m_index.find(canonical);
+      if(it != m_index.end()) {
+        return it->second;
+      }
+      Entry<T> entry;
+      entry.part = part;
+      entry.size = (v_int64) canonical.size();
+      entry.count = 0;
+      entry.existing = false;
+      m_index[std::move(canonical)] = m_entries.size();
+      m_entries.push_back(entry);
+      return m_entries.size() - 1;
+    }
+
+  public:
+
+    /*
+     * Register existing component. Identical inline parts are replaced by references to it if the reference is shorter.
+     */
+    void addComponent(const oatpp::String& name, const typename T::ObjectWrapper& part, const char* refPrefix, v_int64 refSize) {
+      auto index = getIndex(part);
+      auto& entry = m_entries[index];
+      if(!entry.existing && entry.count == 0) {
+        entry.existing = true;
+        if(refSize + name->getSize() < entry.size) {
+          entry.ref = T::createShared();
+          entry.ref->ref = oatpp::String(refPrefix) + name;
+        }
+      }
+    }
+
+    /*
+     * Count inline occurrence. Replacements are looked up by the index of the occurrence.
+     */
+    void addOccurrence(const typename T::ObjectWrapper& part) {
+      auto index = getIndex(part);
+      m_entries[index].count ++;
+      m_occurrences.push_back(index);
+    }
+
+    /*
+     * Choose parts to hoist.
+     */
+    void assignNames(std::unordered_set<std::string>& names, const char* refPrefix, v_int64 refSize) {
+      for(auto& entry : m_entries) {
+        if(entry.existing || entry.count < 2) {
+          continue;
+        }
+        auto name = getFreeName(names, getBaseName(entry.part));
+        auto nameSize = (v_int64) name.size();
+        // inline: count * size. hoisted: count * ref + `"<name>":<part>,` in components
+        if(entry.count * entry.size > entry.count * (refSize + nameSize) + entry.size + nameSize + 4) {
+          names.insert(name);
+          entry.name = oatpp::String(name.data(), (v_buff_size) name.size(), true);
+          entry.ref = T::createShared();
+          entry.ref->ref = oatpp::String(refPrefix) + entry.name;
+        }
+      }
+    }
+
+    /*
+     * Get replacement of the occurrence.
+     */
+    typename T::ObjectWrapper get(size_t occurrence, const typename T::ObjectWrapper& part) const {
+      auto& entry = m_entries[m_occurrences[occurrence]];
+      if(entry.ref) {
+        return entry.ref;
+      }
+      return part;
+    }
+
+    typename Fields<typename T::ObjectWrapper>::ObjectWrapper
+    mergeComponents(const typename Fields<typename T::ObjectWrapper>::ObjectWrapper& components) const {
+
+      bool hasNew = false;
+      for(auto& entry : m_entries) {
+        hasNew = hasNew || entry.name;
+      }
+      if(!hasNew) {
+        return components;
+      }
+
+      auto result = Fields<typename T::ObjectWrapper>::createShared();
+      if(components) {
+        auto curr = components->getFirstEntry();
+        while(curr != nullptr) {
+          result->put(curr->getKey(), curr->getValue());
+          curr = curr->getNext();
+        }
+      }
+      for(auto& entry : m_entries) {
+        if(entry.name) {
+          result->put(entry.name, entry.part);
+        }
+      }
+      return result;
+
+    }
+
+  };
+
+  /*
+   * Copy of the document structure down to the schema slots. Copied objects are private to the result and may be modified.
+   */
+
+  struct Copy {
+    struct Slot {
+      Schema::ObjectWrapper* schema;
+      size_t path;
+    };
+    struct Operation {
+      PathItemOperation::ObjectWrapper operation;
+      size_t path;
+    };
+    std::vector<Slot> slots;
+    std::vector<Operation> operations;
+    std::vector<PathItem::ObjectWrapper> pathItems;
+    std::vector<bool> changed;
+  };
+
+  Fields<MediaTypeObject::ObjectWrapper>::ObjectWrapper copyContent(const Fields<MediaTypeObject::ObjectWrapper>::ObjectWrapper& content,
+                                                                   Copy& copy)
+  {
+    if(!content) {
+      return nullptr;
+    }
+    auto result = Fields<MediaTypeObject::ObjectWrapper>::createShared();
+    auto curr = content->getFirstEntry();
+    while(curr != nullptr) {
+      MediaTypeObject::ObjectWrapper mediaType;
+      if(curr->getValue()) {
+        mediaType = MediaTypeObject::createShared();
+        mediaType->schema = curr->getValue()->schema;
+        copy.slots.push_back({&mediaType->schema, copy.pathItems.size()});
+      }
+      result->put(curr->getKey(), mediaType);
+      curr = curr->getNext();
+    }
+    return result;
+  }
+
+  PathItemOperation::ObjectWrapper copyOperation(const PathItemOperation::ObjectWrapper& operation,
+                                                 Copy& copy)
+  {
+
+    if(!operation) {
+      return nullptr;
+    }
+
+    auto result = PathItemOperation::createShared();
+    result->description = operation->description;
+    result->summary = operation->summary;
+    result->operationId = operation->operationId;
+    result->tags = operation->tags;
+    result->security = operation->security;
+
+    if(operation->requestBody) {
+      result->requestBody = RequestBody::createShared();
+      result->requestBody->description = operation->requestBody->description;
+      result->requestBody->content = copyContent(operation->requestBody->content, copy);
+    }
+
+    if(operation->responses) {
+      result->responses = Fields<OperationResponse::ObjectWrapper>::createShared();
+      auto curr = operation->responses->getFirstEntry();
+      while(curr != nullptr) {
+        auto source = curr->getValue();
+        OperationResponse::ObjectWrapper response;
+        if(source) {
+          response = OperationResponse::createShared();
+          response->description = source->description;
+          response->ref = source->ref;
+          response->content = copyContent(source->content, copy);
+        }
+        result->responses->put(curr->getKey(), response);
+        curr = curr->getNext();
+      }
+    }
+
+    if(operation->parameters) {
+      result->parameters = List<PathItemParameter::ObjectWrapper>::createShared();
+      auto curr = operation->parameters->getFirstNode();
+      while(curr != nullptr) {
+        auto source = curr->getData();
+        auto parameter = PathItemParameter::createShared();
+        parameter->name = source->name;
+        parameter->description = source->description;
+        parameter->in = source->in;
+        parameter->required = source->required;
+        parameter->deprecated = source->deprecated;
+        parameter->schema = source->schema;
+        copy.slots.push_back({&parameter->schema, copy.pathItems.size()});
+        result->parameters->pushBack(parameter);
+        curr = curr->getNext();
+      }
+    }
+
+    copy.operations.push_back({result, copy.pathItems.size()});
+    return result;
+
+  }
+
+  void copyPathItem(const PathItem::ObjectWrapper& pathItem, Copy& copy) {
+    PathItem::ObjectWrapper result;
+    if(pathItem) {
+      result = PathItem::createShared();
+      result->operationGet = copyOperation(pathItem->operationGet, copy);
+      result->operationPut = copyOperation(pathItem->operationPut, copy);
+      result->operationPost = copyOperation(pathItem->operationPost, copy);
+      result->operationDelete = copyOperation(pathItem->operationDelete, copy);
+      result->operationOptions = copyOperation(pathItem->operationOptions, copy);
+      result->operationHead = copyOperation(pathItem->operationHead, copy);
+      result->operationPatch = copyOperation(pathItem->operationPatch, copy);
+      result->operationTrace = copyOperation(pathItem->operationTrace, copy);
+    }
+    copy.pathItems.push_back(result);
+    copy.changed.push_back(false);
+  }
+
+}
+
+Document::ObjectWrapper Deduplicator::deduplicate(const Document::ObjectWrapper& document) {
+
+  OATPP_ASSERT(document && "[oatpp::swagger::oas3::Deduplicator::deduplicate()]: Error. Document should not be null.");
+
+  auto result = Document::createShared();
+  result->openapi = document->openapi;
+  result->info = document->info;
+  result->servers = document->servers;
+
+  Copy copy;
+
+  if(document->paths) {
+    auto curr = document->paths->getFirstEntry();
+    while(curr != nullptr) {
+      copyPathItem(curr->getValue(), copy);
+      curr = curr->getNext();
+    }
+  }
+
+  auto components = document->components;
+
+  // Schemas
+
+  std::unordered_set<std::string> schemaNames;
+  Entries<Schema> schemas;
+
+  if(components && components->schemas) {
+    auto curr = components->schemas->getFirstEntry();
+    while(curr != nullptr) {
+      schemaNames.insert(std::string((const char*) curr->getKey()->getData(), curr->getKey()->getSize()));
+      if(curr->getValue()) {
+        schemas.addComponent(curr->getKey(), curr->getValue(), SCHEMA_REF_PREFIX, SCHEMA_REF_SIZE);
+      }
+      curr = curr->getNext();
+    }
+  }
+
+  std::vector<Copy::Slot> inlineSlots;
+  for(auto& slot : copy.slots) {
+    if(*slot.schema && !(*slot.schema)->ref) {
+      schemas.addOccurrence(*slot.schema);
+      inlineSlots.push_back(slot);
+    }
+  }
+
+  schemas.assignNames(schemaNames, SCHEMA_REF_PREFIX, SCHEMA_REF_SIZE);
+
+  for(size_t i = 0; i < inlineSlots.size(); i ++) {
+    auto& slot = inlineSlots[i];
+    auto schema = schemas.get(i, *slot.schema);
+    if(schema.getPtr() != slot.schema->getPtr()) {
+      *slot.schema = schema;
+      copy.changed[slot.path] = true;
+    }
+  }
+
+  // Responses
+
+  std::unordered_set<std::string> responseNames;
+  Entries<OperationResponse> responses;
+
+  if(components && components->responses) {
+    auto curr = components->responses->getFirstEntry();
+    while(curr != nullptr) {
+      responseNames.insert(std::string((const char*) curr->getKey()->getData(), curr->getKey()->getSize()));
+      if(curr->getValue()) {
+        responses.addComponent(curr->getKey(), curr->getValue(), RESPONSE_REF_PREFIX, RESPONSE_REF_SIZE);
+      }
+      curr = curr->getNext();
+    }
+  }
+
+  for(auto& entry : copy.operations) {
+    auto& operation = entry.operation;
+    if(operation->responses) {
+      auto curr = operation->responses->getFirstEntry();
+      while(curr != nullptr) {
+        if(curr->getValue() && !curr->getValue()->ref) {
+          responses.addOccurrence(curr->getValue());
+        }
+        curr = curr->getNext();
+      }
+    }
+  }
+
+  responses.assignNames(responseNames, RESPONSE_REF_PREFIX, RESPONSE_REF_SIZE);
+
+  size_t occurrence = 0;
+  for(auto& entry : copy.operations) {
+    auto& operation = entry.operation;
+    if(operation->responses) {
+      auto operationResponses = Fields<OperationResponse::ObjectWrapper>::createShared();
+      auto curr = operation->responses->getFirstEntry();
+      while(curr != nullptr) {
+        if(curr->getValue() && !curr->getValue()->ref) {
+          auto response = responses.get(occurrence ++, curr->getValue());
+          if(response.getPtr() != curr->getValue().getPtr()) {
+            copy.changed[entry.path] = true;
+          }
+          operationResponses->put(curr->getKey(), response);
+        } else {
+          operationResponses->put(curr->getKey(), curr->getValue());
+        }
+        curr = curr->getNext();
+      }
+      operation->responses = operationResponses;
+    }
+  }
+
+  // Paths. Path items without replacements are shared with the source document
+
+  if(document->paths) {
+    result->paths = Fields<PathItem::ObjectWrapper>::createShared();
+    size_t index = 0;
+    auto curr = document->paths->getFirstEntry();
+    while(curr != nullptr) {
+      result->paths->put(curr->getKey(), copy.changed[index] ? copy.pathItems[index] : curr->getValue());
+      index ++;
+      curr = curr->getNext();
+    }
+  }
+
+  // Components
+
+  if(components) {
+    result->components = Components::createShared();
+    result->components->schemas = schemas.mergeComponents(components->schemas);
+    result->components->responses = responses.mergeComponents(components->responses);
+    result->components->securitySchemes = components->securitySchemes;
+  } else {
+    auto resultSchemas = schemas.mergeComponents(nullptr);
+    auto resultResponses = responses.mergeComponents(nullptr);
+    if(resultSchemas || resultResponses) {
+      result->components = Components::createShared();
+      result->components->schemas = resultSchemas;
+      result->components->responses = resultResponses;
+    }
+  }
+
+  return result;
+
+}
+
+}}}
@@ -0,0 +1,64 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_swagger_oas3_Deduplicator_hpp
+#define oatpp_swagger_oas3_Deduplicator_hpp
+
+#include "oatpp-swagger/oas3/Model.hpp"
+
+namespace oatpp { namespace swagger { namespace oas3 {
+
+/**
+ * Hoists structurally identical inline parts of the generated &id:oatpp::swagger::oas3::Document; into components. <br>
+ * Inline schemas of request bodies, responses and parameters which occur more than once are moved to `components/schemas`,
+ * identical operation responses (ex.: shared error responses) are moved to `components/responses`.
+ * Occurrences are replaced with `$ref`s. <br>
+ * A part is hoisted only if it makes the serialized document smaller, so short schemas like `{"type":"string"}` stay inline.
+ * Inline parts identical to already existing components are replaced with `$ref`s to these components. <br>
+ * Source document is never modified. Schemas and other leaf parts are shared between the source and the result.
+ */
+class Deduplicator {
+public:
+
+  template <class Value>
+  using Fields = oatpp::data::mapping::type::ListMap<String, Value>;
+
+  template <class Value>
+  using List = oatpp::data::mapping::type::List<Value>;
+
+public:
+
+  /**
+   * Create deduplicated version of the document.
+   * @param document - &id:oatpp::swagger::oas3::Document;.
+   * @return - &id:oatpp::swagger::oas3::Document;.
+   */
+  static Document::ObjectWrapper deduplicate(const Document::ObjectWrapper& document);
+
+};
+
+}}}
+
+#endif /* oatpp_swagger_oas3_Deduplicator_hpp */
@@ -0,0 +1,491 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "DocumentFilter.hpp"
+
+#include <cstring>
+#include <unordered_map>
+
+namespace oatpp { namespace swagger { namespace oas3 {
+
+namespace {
+  const char* const SCHEMA_REF_PREFIX = "#/components/schemas/";
+  const v_buff_size SCHEMA_REF_PREFIX_SIZE = 21;
+  const char* const RESPONSE_REF_PREFIX = "#/components/responses/";
+  const v_buff_size RESPONSE_REF_PREFIX_SIZE = 23;
+}
+
+Info::ObjectWrapper DocumentFilter::createLiteInfo(const Info::ObjectWrapper& info) {
+  if(!info) {
+    return nullptr;
+  }
+  auto result = Info::createShared();
+  result->title = info->title;
+  result->contact = info->contact;
+  result->license = info->license;
+  result->version = info->version;
+  return result;
+}
+
+Server::ObjectWrapper DocumentFilter::createLiteServer(const Server::ObjectWrapper& server) {
+
+  if(!server) {
+    return nullptr;
+  }
+
+  auto result = Server::createShared();
+  result->url = server->url;
+
+  if(server->variables) {
+    result->variables = Fields<ServerVariable::ObjectWrapper>::createShared();
+    auto curr = server->variables->getFirstEntry();
+    while(curr != nullptr) {
+      auto variable = ServerVariable::createShared();
+      variable->enumValues = curr->getValue()->enumValues;
+      variable->defaultValue = curr->getValue()->defaultValue;
+      result->variables->put(curr->getKey(), variable);
+      curr = curr->getNext();
+    }
+  }
+
+  return result;
+
+}
+
+OperationResponse::ObjectWrapper DocumentFilter::createLiteResponse(const OperationResponse::ObjectWrapper& response) {
+
+  if(!response) {
+    return nullptr;
+  }
+
+  auto result = OperationResponse::createShared();
+  if(response->ref) {
+    result->ref = response->ref;
+  } else {
+    result->description = ""; // required field
+    result->content = response->content;
+  }
+  return result;
+
+}
+
+PathItemOperation::ObjectWrapper DocumentFilter::createLiteOperation(const PathItemOperation::ObjectWrapper& operation) {
+
+  if(!operation) {
+    return nullptr;
+  }
+
+  auto result = PathItemOperation::createShared();
+  result->operationId = operation->operationId;
+  result->tags = operation->tags;
+  result->security = operation->security;
+
+  if(operation->requestBody) {
+    result->requestBody = RequestBody::createShared();
+    result->requestBody->content = operation->requestBody->content;
+  }
+
+  if(operation->responses) {
+    result->responses = Fields<OperationResponse::ObjectWrapper>::createShared();
+    auto curr = operation->responses->getFirstEntry();
+    while(curr != nullptr) {
+      result->responses->put(curr->getKey(), createLiteResponse(curr->getValue()));
+      curr = curr->getNext();
+    }
+  }
+
+  if(operation->parameters) {
+    result->parameters = List<PathItemParameter::ObjectWrapper>::createShared();
+    auto curr = operation->parameters->getFirstNode();
+    while(curr != nullptr) {
+      auto param = curr->getData();
+      auto parameter = PathItemParameter::createShared();
+      parameter->name = param->name;
+      parameter->in = param->in;
+      parameter->required = param->required;
+      parameter->deprecated = param->deprecated;
+      parameter->schema = param->schema;
+      result->parameters->pushBack(parameter);
+      curr = curr->getNext();
+    }
+  }
+
+  return result;
+
+}
+
+PathItem::ObjectWrapper DocumentFilter::createLitePathItem(const PathItem::ObjectWrapper& pathItem) {
+  auto result = PathItem::createShared();
+  result->operationGet = createLiteOperation(pathItem->operationGet);
+  result->operationPut = createLiteOperation(pathItem->operationPut);
+  result->operationPost = createLiteOperation(pathItem->operationPost);
+  result->operationDelete = createLiteOperation(pathItem->operationDelete);
+  result->operationOptions = createLiteOperation(pathItem->operationOptions);
+  result->operationHead = createLiteOperation(pathItem->operationHead);
+  result->operationPatch = createLiteOperation(pathItem->operationPatch);
+  result->operationTrace = createLiteOperation(pathItem->operationTrace);
+  return result;
+}
+
+Components::ObjectWrapper DocumentFilter::createLiteComponents(const Components::ObjectWrapper& components) {
+
+  if(!components) {
+    return nullptr;
+  }
+
+  auto result = Components::createShared();
+  result->schemas = components->schemas;
+
+  if(components->responses) {
+    result->responses = Fields<OperationResponse::ObjectWrapper>::createShared();
+    auto curr = components->responses->getFirstEntry();
+    while(curr != nullptr) {
+      result->responses->put(curr->getKey(), createLiteResponse(curr->getValue()));
+      curr = curr->getNext();
+    }
+  }
+
+  if(components->securitySchemes) {
+    result->securitySchemes = Fields<SecurityScheme::ObjectWrapper>::createShared();
+    auto curr = components->securitySchemes->getFirstEntry();
+    while(curr != nullptr) {
+      auto ss = curr->getValue();
+      auto scheme = SecurityScheme::createShared();
+      scheme->type = ss->type;
+      scheme->name = ss->name;
+      scheme->in = ss->in;
+      scheme->scheme = ss->scheme;
+      scheme->bearerFormat = ss->bearerFormat;
+      scheme->flows = ss->flows;
+      scheme->openIdConnectUrl = ss->openIdConnectUrl;
+      result->securitySchemes->put(curr->getKey(), scheme);
+      curr = curr->getNext();
+    }
+  }
+
+  return result;
+
+}
+
+Document::ObjectWrapper DocumentFilter::createLiteDocument(const Document::ObjectWrapper& document) {
+
+  OATPP_ASSERT(document && "[oatpp::swagger::oas3::DocumentFilter::createLiteDocument()]: Error. Document should not be null.");
+
+  auto result = Document::createShared();
+  result->openapi = document->openapi;
+  result->info = createLiteInfo(document->info);
+
+  if(document->servers) {
+    result->servers = List<Server::ObjectWrapper>::createShared();
+    auto curr = document->servers->getFirstNode();
+    while(curr != nullptr) {
+      result->servers->pushBack(createLiteServer(curr->getData()));
+      curr = curr->getNext();
+    }
+  }
+
+  if(document->paths) {
+    result->paths = Fields<PathItem::ObjectWrapper>::createShared();
+    auto curr = document->paths->getFirstEntry();
+    while(curr != nullptr) {
+      result->paths->put(curr->getKey(), createLitePathItem(curr->getValue()));
+      curr = curr->getNext();
+    }
+  }
+
+  result->components = createLiteComponents(document->components);
+
+  return result;
+
+}
+
+bool DocumentFilter::hasAnyTag(const PathItemOperation::ObjectWrapper& operation, const std::unordered_set<oatpp::String>& tags) {
+  if(!operation || !operation->tags) {
+    return false;
+  }
+  auto curr = operation->tags->getFirstNode();
+  while(curr != nullptr) {
+    if(tags.find(curr->getData()) != tags.end()) {
+      return true;
+    }
+    curr = curr->getNext();
+  }
+  return false;
+}
+
+void DocumentFilter::collectOperationTags(const PathItemOperation::ObjectWrapper& operation, std::unordered_set<oatpp::String>& tags) {
+  if(!operation || !operation->tags) {
+    return;
+  }
+  auto curr = operation->tags->getFirstNode();
+  while(curr != nullptr) {
+    if(curr->getData()) {
+      tags.insert(curr->getData());
+    }
+    curr = curr->getNext();
+  }
+}
+
+void DocumentFilter::collectSchemaRefs(const Schema::ObjectWrapper& schema,
+                                       std::unordered_set<oatpp::String>& names,
+                                       std::vector<oatpp::String>& queue)
+{
+
+  if(!schema) {
+    return;
+  }
+
+  if(schema->ref && schema->ref->getSize() > SCHEMA_REF_PREFIX_SIZE &&
+     std::memcmp(schema->ref->getData(), SCHEMA_REF_PREFIX, SCHEMA_REF_PREFIX_SIZE) == 0)
+  {
+    oatpp::String name((const char*) schema->ref->getData() + SCHEMA_REF_PREFIX_SIZE, schema->ref->getSize() - SCHEMA_REF_PREFIX_SIZE, true);
+    if(names.insert(name).second) {
+      queue.push_back(name);
+    }
+  }
+
+  if(schema->properties) {
+    auto curr = schema->properties->getFirstEntry();
+    while(curr != nullptr) {
+      collectSchemaRefs(curr->getValue(), names, queue);
+      curr = curr->getNext();
+    }
+  }
+
+  collectSchemaRefs(schema->items, names, queue);
+  collectSchemaRefs(schema->additionalProperties, names, queue);
+
+}
+
+void DocumentFilter::collectContentRefs(const Fields<MediaTypeObject::ObjectWrapper>::ObjectWrapper& content,
+                                        std::unordered_set<oatpp::String>& names,
+                                        std::vector<oatpp::String>& queue)
+{
+  if(content) {
+    auto curr = content->getFirstEntry();
+    while(curr != nullptr) {
+      if(curr->getValue()) {
+        collectSchemaRefs(curr->getValue()->schema, names, queue);
+      }
+      curr = curr->getNext();
+    }
+  }
+}
+
+void DocumentFilter::collectResponseRefs(const OperationResponse::ObjectWrapper& response,
+                                         std::unordered_set<oatpp::String>& responseNames,
+                                         std::unordered_set<oatpp::String>& schemaNames,
+                                         std::vector<oatpp::String>& schemaQueue)
+{
+
+  if(!response) {
+    return;
+  }
+
+  if(response->ref && response->ref->getSize() > RESPONSE_REF_PREFIX_SIZE &&
+     std::memcmp(response->ref->getData(), RESPONSE_REF_PREFIX, RESPONSE_REF_PREFIX_SIZE) == 0)
+  {
+    responseNames.insert(oatpp::String((const char*) response->ref->getData() + RESPONSE_REF_PREFIX_SIZE, response->ref->getSize() - RESPONSE_REF_PREFIX_SIZE, true));
+  }
+
+  collectContentRefs(response->content, schemaNames, schemaQueue);
+
+}
+
+PathItemOperation::ObjectWrapper DocumentFilter::filterOperation(const PathItemOperation::ObjectWrapper& operation,
+                                                                 const std::unordered_set<oatpp::String>& tags,
+                                                                 std::unordered_set<oatpp::String>& schemaNames,
+                                                                 std::vector<oatpp::String>& schemaQueue,
+                                                                 std::unordered_set<oatpp::String>& responseNames,
+                                                                 std::unordered_set<oatpp::String>& securitySchemeNames)
+{
+
+  if(!hasAnyTag(operation, tags)) {
+    return nullptr;
+  }
+
+  if(operation->requestBody) {
+    collectContentRefs(operation->requestBody->content, schemaNames, schemaQueue);
+  }
+
+  if(operation->responses) {
+    auto curr = operation->responses->getFirstEntry();
+    while(curr != nullptr) {
+      collectResponseRefs(curr->getValue(), responseNames, schemaNames, schemaQueue);
+      curr = curr->getNext();
+    }
+  }
+
+  if(operation->parameters) {
+    auto curr = operation->parameters->getFirstNode();
+    while(curr != nullptr) {
+      collectSchemaRefs(curr->getData()->schema, schemaNames, schemaQueue);
+      curr = curr->getNext();
+    }
+  }
+
+  if(operation->security) {
+    auto curr = operation->security->getFirstNode();
+    while(curr != nullptr) {
+      auto requirement = curr->getData()->getFirstEntry();
+      while(requirement != nullptr) {
+        securitySchemeNames.insert(requirement->getKey());
+        requirement = requirement->getNext();
+      }
+      curr = curr->getNext();
+    }
+  }
+
+  return operation;
+
+}
+
+Document::ObjectWrapper DocumentFilter::createTaggedDocument(const Document::ObjectWrapper& document, const std::unordered_set<oatpp::String>& tags) {
+
+  OATPP_ASSERT(document && "[oatpp::swagger::oas3::DocumentFilter::createTaggedDocument()]: Error. Document should not be null.");
+
+  auto result = Document::createShared();
+  result->openapi = document->openapi;
+  result->info = document->info;
+  result->servers = document->servers;
+  result->paths = Fields<PathItem::ObjectWrapper>::createShared();
+
+  std::unordered_set<oatpp::String> schemaNames;
+  std::vector<oatpp::String> schemaQueue;
+  std::unordered_set<oatpp::String> responseNames;
+  std::unordered_set<oatpp::String> securitySchemeNames;
+
+  if(document->paths) {
+    auto curr = document->paths->getFirstEntry();
+    while(curr != nullptr) {
+
+      auto pathItem = curr->getValue();
+      auto filtered = PathItem::createShared();
+      filtered->operationGet = filterOperation(pathItem->operationGet, tags, schemaNames, schemaQueue, responseNames, securitySchemeNames);
+      filtered->operationPut = filterOperation(pathItem->operationPut, tags, schemaNames, schemaQueue, responseNames, securitySchemeNames);
+      filtered->operationPost = filterOperation(pathItem->operationPost, tags, schemaNames, schemaQueue, responseNames, securitySchemeNames);
+      filtered->operationDelete = filterOperation(pathItem->operationDelete, tags, schemaNames, schemaQueue, responseNames, securitySchemeNames);
+      filtered->operationOptions = filterOperation(pathItem->operationOptions, tags, schemaNames, schemaQueue, responseNames, securitySchemeNames);
+      filtered->operationHead = filterOperation(pathItem->operationHead, tags, schemaNames, schemaQueue, responseNames, securitySchemeNames);
+      filtered->operationPatch = filterOperation(pathItem->operationPatch, tags, schemaNames, schemaQueue, responseNames, securitySchemeNames);
+      filtered->operationTrace = filterOperation(pathItem->operationTrace, tags, schemaNames, schemaQueue, responseNames, securitySchemeNames);
+
+      if(filtered->operationGet || filtered->operationPut || filtered->operationPost || filtered->operationDelete ||
+         filtered->operationOptions || filtered->operationHead || filtered->operationPatch || filtered->operationTrace)
+      {
+        result->paths->put(curr->getKey(), filtered);
+      }
+
+      curr = curr->getNext();
+    }
+  }
+
+  if(document->components) {
+
+    result->components = Components::createShared();
+
+    if(document->components->responses) {
+      // keep the original order of components
+      result->components->responses = Fields<OperationResponse::ObjectWrapper>::createShared();
+      auto curr = document->components->responses->getFirstEntry();
+      while(curr != nullptr) {
+        if(responseNames.find(curr->getKey()) != responseNames.end()) {
+          result->components->responses->put(curr->getKey(), curr->getValue());
+          collectContentRefs(curr->getValue()->content, schemaNames, schemaQueue);
+        }
+        curr = curr->getNext();
+      }
+    }
+
+    if(document->components->schemas) {
+
+      // resolve schemas referenced from other schemas. ListMap lookup is a linear walk - schemas are found through the index
+      std::unordered_map<oatpp::String, Schema::ObjectWrapper> schemaIndex;
+      auto schema = document->components->schemas->getFirstEntry();
+      while(schema != nullptr) {
+        schemaIndex[schema->getKey()] = schema->getValue();
+        schema = schema->getNext();
+      }
+
+      while(!schemaQueue.empty()) {
+        auto name = schemaQueue.back();
+        schemaQueue.pop_back();
+        auto it = schemaIndex.find(name);
+        collectSchemaRefs(it != schemaIndex.end() ? it->second : nullptr, schemaNames, schemaQueue);
+      }
+
+      // keep the original order of components
+      result->components->schemas = Fields<Schema::ObjectWrapper>::createShared();
+      auto curr = document->components->schemas->getFirstEntry();
+      while(curr != nullptr) {
+        if(schemaNames.find(curr->getKey()) != schemaNames.end()) {
+          result->components->schemas->put(curr->getKey(), curr->getValue());
+        }
+        curr = curr->getNext();
+      }
+
+    }
+
+    if(document->components->securitySchemes) {
+      result->components->securitySchemes = Fields<SecurityScheme::ObjectWrapper>::createShared();
+      auto curr = document->components->securitySchemes->getFirstEntry();
+      while(curr != nullptr) {
+        if(securitySchemeNames.find(curr->getKey()) != securitySchemeNames.end()) {
+          result->components->securitySchemes->put(curr->getKey(), curr->getValue());
+        }
+        curr = curr->getNext();
+      }
+    }
+
+  }
+
+  return result;
+
+}
+
+void DocumentFilter::collectTags(const Document::ObjectWrapper& document, std::unordered_set<oatpp::String>& tags) {
+
+  OATPP_ASSERT(document && "[oatpp::swagger::oas3::DocumentFilter::collectTags()]: Error. Document should not be null.");
+
+  if(!document->paths) {
+    return;
+  }
+
+  auto curr = document->paths->getFirstEntry();
+  while(curr != nullptr) {
+    auto pathItem = curr->getValue();
+    collectOperationTags(pathItem->operationGet, tags);
+    collectOperationTags(pathItem->operationPut, tags);
+    collectOperationTags(pathItem->operationPost, tags);
+    collectOperationTags(pathItem->operationDelete, tags);
+    collectOperationTags(pathItem->operationOptions, tags);
+    collectOperationTags(pathItem->operationHead, tags);
+    collectOperationTags(pathItem->operationPatch, tags);
+    collectOperationTags(pathItem->operationTrace, tags);
+    curr = curr->getNext();
+  }
+
+}
+
+}}}
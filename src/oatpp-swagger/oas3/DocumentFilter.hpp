@@ -0,0 +1,102 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_swagger_oas3_DocumentFilter_hpp
+#define oatpp_swagger_oas3_DocumentFilter_hpp
+
+#include "oatpp-swagger/oas3/Model.hpp"
+
+#include <unordered_set>
+#include <vector>
+
+namespace oatpp { namespace swagger { namespace oas3 {
+
+/**
+ * Derives reduced documents from the generated &id:oatpp::swagger::oas3::Document;. <br>
+ * Source document is never modified. Parts which are not changed by the filter are shared between the source and the result.
+ */
+class DocumentFilter {
+public:
+
+  template <class Value>
+  using Fields = oatpp::data::mapping::type::ListMap<String, Value>;
+
+  template <class Value>
+  using List = oatpp::data::mapping::type::List<Value>;
+
+private:
+  static Info::ObjectWrapper createLiteInfo(const Info::ObjectWrapper& info);
+  static Server::ObjectWrapper createLiteServer(const Server::ObjectWrapper& server);
+  static OperationResponse::ObjectWrapper createLiteResponse(const OperationResponse::ObjectWrapper& response);
+  static PathItemOperation::ObjectWrapper createLiteOperation(const PathItemOperation::ObjectWrapper& operation);
+  static PathItem::ObjectWrapper createLitePathItem(const PathItem::ObjectWrapper& pathItem);
+  static Components::ObjectWrapper createLiteComponents(const Components::ObjectWrapper& components);
+private:
+  static bool hasAnyTag(const PathItemOperation::ObjectWrapper& operation, const std::unordered_set<oatpp::String>& tags);
+  static void collectOperationTags(const PathItemOperation::ObjectWrapper& operation, std::unordered_set<oatpp::String>& tags);
+  static void collectSchemaRefs(const Schema::ObjectWrapper& schema, std::unordered_set<oatpp::String>& names, std::vector<oatpp::String>& queue);
+  static void collectContentRefs(const Fields<MediaTypeObject::ObjectWrapper>::ObjectWrapper& content, std::unordered_set<oatpp::String>& names, std::vector<oatpp::String>& queue);
+  static void collectResponseRefs(const OperationResponse::ObjectWrapper& response,
+                                  std::unordered_set<oatpp::String>& responseNames,
+                                  std::unordered_set<oatpp::String>& schemaNames,
+                                  std::vector<oatpp::String>& schemaQueue);
+  static PathItemOperation::ObjectWrapper filterOperation(const PathItemOperation::ObjectWrapper& operation,
+                                                          const std::unordered_set<oatpp::String>& tags,
+                                                          std::unordered_set<oatpp::String>& schemaNames,
+                                                          std::vector<oatpp::String>& schemaQueue,
+                                                          std::unordered_set<oatpp::String>& responseNames,
+                                                          std::unordered_set<oatpp::String>& securitySchemeNames);
+public:
+
+  /**
+   * Create "lite" version of the document for machine consumers. <br>
+   * All free-text fields (`description`, `summary`, `termsOfService`) are left out.
+   * Structure, schemas and `$ref`s are kept. Descriptions of responses are required by the specification, so they are set to empty strings.
+   * @param document - &id:oatpp::swagger::oas3::Document;.
+   * @return - &id:oatpp::swagger::oas3::Document;.
+   */
+  static Document::ObjectWrapper createLiteDocument(const Document::ObjectWrapper& document);
+
+  /**
+   * Create sub-document containing only operations tagged with at least one of the given tags. <br>
+   * Path items without remaining operations are left out. Only `components/schemas` and `components/responses` transitively referenced by
+   * the remaining operations, and security schemes they require, are kept.
+   * @param document - &id:oatpp::swagger::oas3::Document;.
+   * @param tags - set of tags.
+   * @return - &id:oatpp::swagger::oas3::Document;.
+   */
+  static Document::ObjectWrapper createTaggedDocument(const Document::ObjectWrapper& document, const std::unordered_set<oatpp::String>& tags);
+
+  /**
+   * Collect tags of all operations of the document.
+   * @param document - &id:oatpp::swagger::oas3::Document;.
+   * @param tags - set to put tags to.
+   */
+  static void collectTags(const Document::ObjectWrapper& document, std::unordered_set<oatpp::String>& tags);
+
+};
+
+}}}
+
+#endif /* oatpp_swagger_oas3_DocumentFilter_hpp */
@@ -24,25 +24,450 @@
 
 #include "Generator.hpp"
 
+#include "oatpp-swagger/oas3/Deduplicator.hpp"
+#include "oatpp-swagger/Types.hpp"
+
 #include "oatpp/core/utils/ConversionUtils.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
 namespace oatpp { namespace swagger { namespace oas3 {
 
+namespace {
+
+  /*
+   * Endpoint::Info::tags is not present in every oatpp version.
+   * The first overload is picked when the field exists, the second one is a no-op fallback.
+   */
+  template<class T>
+  auto copyEndpointTags(Generator& generator, const T& info, const PathItemOperation::ObjectWrapper& operation, int) -> decltype(info.tags.begin(), void()) {
+    if(!info.tags.empty()) {
+      operation->tags = generator.create<oatpp::data::mapping::type::List<oatpp::String>>();
+      for(const auto& tag : info.tags) {
+        operation->tags->pushBack(tag);
+      }
+    }
+  }
+
+  template<class T>
+  void copyEndpointTags(Generator&, const T&, const PathItemOperation::ObjectWrapper&, long) {
+  }
+
+  /*
+   * Schemas are cached and outlive the generation, so objects created while generating a schema are never
+   * allocated from the arena of the generation.
+   */
+  thread_local v_int32 SCHEMA_DEPTH = 0;
+
+  class SchemaScope {
+  public:
+    SchemaScope() {
+      SCHEMA_DEPTH ++;
+    }
+    ~SchemaScope() {
+      SCHEMA_DEPTH --;
+    }
+  };
+
+  struct Method {
+    const char* name;
+    v_buff_size size;
+    PathItemOperation::ObjectWrapper PathItem::* field;
+  };
+
+  const Method METHODS[] = {
+    {"get", 3, &PathItem::operationGet},
+    {"put", 3, &PathItem::operationPut},
+    {"post", 4, &PathItem::operationPost},
+    {"delete", 6, &PathItem::operationDelete},
+    {"options", 7, &PathItem::operationOptions},
+    {"head", 4, &PathItem::operationHead},
+    {"patch", 5, &PathItem::operationPatch},
+    {"trace", 5, &PathItem::operationTrace}
+  };
+
+  /*
+   * Slot is computed from the lowercase first letter and the length of the method name.
+   * It is unique for each of METHODS.
+   */
+  v_int32 getMethodSlot(const char* name, v_buff_size size) {
+    return ((name[0] | 0x20) ^ (v_int32) size) & 31;
+  }
+
+  const Method* findMethod(const oatpp::String& name) {
+
+    static const std::vector<const Method*> table = [] {
+      std::vector<const Method*> result(32, nullptr);
+      for(const Method& method : METHODS) {
+        auto& slot = result[getMethodSlot(method.name, method.size)];
+        OATPP_ASSERT(slot == nullptr && "[oatpp-swagger::oas3::Generator::findMethod()]: Error. Method slots collide.");
+        slot = &method;
+      }
+      return result;
+    }();
+
+    if(!name || name->getSize() == 0) {
+      return nullptr;
+    }
+
+    const Method* method = table[getMethodSlot(name->c_str(), name->getSize())];
+    if(method && method->size == name->getSize() && oatpp::base::StrBuffer::equalsCI(method->name, name->c_str(), name->getSize())) {
+      return method;
+    }
+
+    return nullptr;
+
+  }
+
+
+  /*
+   * Byte-wise order of strings - doesn't depend on locale or on iteration order of hash maps.
+   */
+  struct StringLess {
+    bool operator()(const oatpp::String& a, const oatpp::String& b) const {
+      auto size = a->getSize() < b->getSize() ? a->getSize() : b->getSize();
+      auto result = std::memcmp(a->getData(), b->getData(), size);
+      return result < 0 || (result == 0 && a->getSize() < b->getSize());
+    }
+  };
+
+  template<class Map>
+  std::vector<oatpp::String> getSortedKeys(const Map& map) {
+    std::vector<oatpp::String> result;
+    result.reserve(map.size());
+    for(const auto& entry : map) {
+      result.push_back(entry.first);
+    }
+    std::sort(result.begin(), result.end(), StringLess());
+    return result;
+  }
+
+  template<class Value>
+  typename oatpp::data::mapping::type::ListMap<oatpp::String, Value>::ObjectWrapper
+  sortFields(const typename oatpp::data::mapping::type::ListMap<oatpp::String, Value>::ObjectWrapper& fields) {
+
+    if(!fields) {
+      return fields;
+    }
+
+    std::vector<std::pair<oatpp::String, Value>> entries;
+    auto curr = fields->getFirstEntry();
+    while(curr != nullptr) {
+      entries.push_back({curr->getKey(), curr->getValue()});
+      curr = curr->getNext();
+    }
+
+    std::stable_sort(entries.begin(), entries.end(), [](const std::pair<oatpp::String, Value>& a, const std::pair<oatpp::String, Value>& b) {
+      return StringLess()(a.first, b.first);
+    });
+
+    auto result = oatpp::data::mapping::type::ListMap<oatpp::String, Value>::createShared();
+    for(const auto& entry : entries) {
+      result->put(entry.first, entry.second);
+    }
+    return result;
+
+  }
+
+  /*
+   * Should be changed whenever generator output changes for the same inputs, so that stale snapshots are dropped.
+   */
+  const char* const FINGERPRINT_VERSION = "oatpp-swagger/oas3/3";
+
+  /*
+   * Incremental 64-bit FNV-1a over the document inputs.
+   * Strings are length-prefixed so that adjacent fields can't be confused. Entries of unordered containers are
+   * hashed separately and summed up, so the result doesn't depend on the iteration order.
+   */
+  class FingerprintHash {
+  private:
+    v_uint64 m_hash;
+  public:
+
+    FingerprintHash()
+      : m_hash(14695981039346656037ULL)
+    {}
+
+    void update(const void* data, v_buff_size size) {
+      auto bytes = (const v_char8*) data;
+      for(v_buff_size i = 0; i < size; i ++) {
+        m_hash ^= bytes[i];
+        m_hash *= 1099511628211ULL;
+      }
+    }
+
+    void updateInt(v_int64 value) {
+      for(v_int32 i = 0; i < 8; i ++) {
+        v_char8 byte = (v_char8) ((v_uint64) value >> (i * 8));
+        update(&byte, 1);
+      }
+    }
+
+    void updateString(const char* str) {
+      if(str == nullptr) {
+        updateInt(-1);
+        return;
+      }
+      v_buff_size size = (v_buff_size) std::strlen(str);
+      updateInt(size);
+      update(str, size);
+    }
+
+    void updateString(const oatpp::String& str) {
+      if(!str) {
+        updateInt(-1);
+        return;
+      }
+      updateInt(str->getSize());
+      update(str->getData(), str->getSize());
+    }
+
+    void updateBoolean(const oatpp::Boolean& value) {
+      updateInt(value ? (value->getValue() ? 1 : 0) : -1);
+    }
+
+    v_uint64 get() const {
+      return m_hash;
+    }
+
+  };
+
+  void hashType(FingerprintHash& hash, const oatpp::data::mapping::type::Type* type,
+                std::unordered_set<const oatpp::data::mapping::type::Type*>& visited)
+  {
+
+    namespace type_ns = oatpp::data::mapping::type;
+
+    if(type == nullptr) {
+      hash.updateInt(-1);
+      return;
+    }
+
+    hash.updateString(type->name);
+    hash.updateString(type->nameQualifier);
+
+    // recursive types are hashed by name on the second visit
+    if(!visited.insert(type).second) {
+      return;
+    }
+
+    if(type->name == type_ns::__class::AbstractObject::CLASS_NAME) {
+      auto properties = type->properties;
+      if(properties->getList().size() == 0) {
+        type->creator(); // init type by creating first instance of that type
+      }
+      hash.updateInt((v_int64) properties->getList().size());
+      for(auto p : properties->getList()) {
+        hash.updateString(p->name);
+        hashType(hash, p->type, visited);
+      }
+    } else {
+      hash.updateInt((v_int64) type->params.size());
+      for(auto param : type->params) {
+        hashType(hash, param, visited);
+      }
+    }
+
+  }
+
+  template<class T>
+  auto hashEndpointTags(FingerprintHash& hash, const T& info, int) -> decltype(info.tags.begin(), void()) {
+    hash.updateInt((v_int64) info.tags.size());
+    for(const auto& tag : info.tags) {
+      hash.updateString(tag);
+    }
+  }
+
+  template<class T>
+  void hashEndpointTags(FingerprintHash&, const T&, long) {
+  }
+
+  template<class Params>
+  void hashParams(FingerprintHash& hash, Params& params, std::unordered_set<const oatpp::data::mapping::type::Type*>& visited) {
+    hash.updateInt((v_int64) params.getOrder().size());
+    for(const auto& name : params.getOrder()) {
+      auto param = params[name];
+      oatpp::Boolean required;
+      required = param.required;
+      oatpp::Boolean deprecated;
+      deprecated = param.deprecated;
+      hash.updateString(name);
+      hash.updateString(param.description);
+      hash.updateBoolean(required);
+      hash.updateBoolean(deprecated);
+      hashType(hash, param.type, visited);
+    }
+  }
+
+  void hashOAuthFlow(FingerprintHash& hash, const std::shared_ptr<oatpp::swagger::OAuthFlow>& flow) {
+    if(!flow) {
+      hash.updateInt(-1);
+      return;
+    }
+    hash.updateString(flow->authorizationUrl);
+    hash.updateString(flow->tokenUrl);
+    hash.updateString(flow->refreshUrl);
+    v_uint64 scopes = 0;
+    if(flow->scopes) {
+      for(const auto& scope : *flow->scopes) {
+        FingerprintHash entry;
+        entry.updateString(scope.first);
+        entry.updateString(scope.second);
+        scopes += entry.get();
+      }
+    }
+    hash.updateInt((v_int64) scopes);
+  }
+
+  void hashDocumentInfo(FingerprintHash& hash, const std::shared_ptr<oatpp::swagger::DocumentInfo>& docInfo) {
+
+    auto header = docInfo->header;
+    if(header) {
+      hash.updateString(header->title);
+      hash.updateString(header->description);
+      hash.updateString(header->termsOfService);
+      hash.updateString(header->version);
+      if(header->contact) {
+        hash.updateString(header->contact->name);
+        hash.updateString(header->contact->url);
+        hash.updateString(header->contact->email);
+      }
+      if(header->license) {
+        hash.updateString(header->license->name);
+        hash.updateString(header->license->url);
+      }
+    }
+
+    if(docInfo->servers) {
+      hash.updateInt((v_int64) docInfo->servers->size());
+      for(const auto& server : *docInfo->servers) {
+        hash.updateString(server->url);
+        hash.updateString(server->description);
+        v_uint64 variables = 0;
+        if(server->variables) {
+          for(const auto& variable : *server->variables) {
+            FingerprintHash entry;
+            entry.updateString(variable.first);
+            entry.updateString(variable.second->description);
+            entry.updateString(variable.second->defaultValue);
+            if(variable.second->enumValues) {
+              for(const auto& value : *variable.second->enumValues) {
+                entry.updateString(value);
+              }
+            }
+            variables += entry.get();
+          }
+        }
+        hash.updateInt((v_int64) variables);
+      }
+    }
+
+    v_uint64 securitySchemes = 0;
+    if(docInfo->securitySchemes) {
+      for(const auto& ss : *docInfo->securitySchemes) {
+        FingerprintHash entry;
+        entry.updateString(ss.first);
+        entry.updateString(ss.second->type);
+        entry.updateString(ss.second->description);
+        entry.updateString(ss.second->name);
+        entry.updateString(ss.second->in);
+        entry.updateString(ss.second->scheme);
+        entry.updateString(ss.second->bearerFormat);
+        entry.updateString(ss.second->openIdConnectUrl);
+        if(ss.second->flows) {
+          hashOAuthFlow(entry, ss.second->flows->implicit);
+          hashOAuthFlow(entry, ss.second->flows->password);
+          hashOAuthFlow(entry, ss.second->flows->clientCredentials);
+          hashOAuthFlow(entry, ss.second->flows->authorizationCode);
+        }
+        securitySchemes += entry.get();
+      }
+    }
+    hash.updateInt((v_int64) securitySchemes);
+
+  }
+
+  void hashEndpointInfo(FingerprintHash& hash, oatpp::web::server::api::Endpoint::Info& info,
+                        std::unordered_set<const oatpp::data::mapping::type::Type*>& visited)
+  {
+
+    hash.updateString(info.name);
+    hash.updateString(info.summary);
+    hash.updateString(info.description);
+    hash.updateString(info.path);
+    hash.updateString(info.method);
+    hash.updateString(info.authorization);
+    hash.updateInt(info.hide ? 1 : 0);
+    hashEndpointTags(hash, info, 0);
+
+    hash.updateString(info.body.name);
+    hashType(hash, info.body.type, visited);
+    hash.updateString(info.bodyContentType);
+
+    hash.updateInt((v_int64) info.consumes.size());
+    for(const auto& hint : info.consumes) {
+      hash.updateString(hint.contentType);
+      hashType(hash, hint.schema, visited);
+    }
+
+    v_uint64 responses = 0;
+    for(const auto& response : info.responses) {
+      FingerprintHash entry;
+      std::unordered_set<const oatpp::data::mapping::type::Type*> entryVisited;
+      entry.updateInt(response.first.code);
+      entry.updateString(response.first.description);
+      entry.updateString(response.second.contentType);
+      hashType(entry, response.second.schema, entryVisited);
+      responses += entry.get();
+    }
+    hash.updateInt((v_int64) responses);
+
+    hashParams(hash, info.headers, visited);
+    hashParams(hash, info.pathParams, visited);
+    hashParams(hash, info.queryParams, visited);
+
+    v_uint64 security = 0;
+    for(const auto& sec : info.securityRequirements) {
+      FingerprintHash entry;
+      entry.updateString(sec.first);
+      if(sec.second) {
+        for(const auto& scope : *sec.second) {
+          entry.updateString(scope);
+        }
+      }
+      security += entry.get();
+    }
+    hash.updateInt((v_int64) security);
+
+  }
+
+}
+
 Schema::ObjectWrapper Generator::generateSchemaForTypeObject(const oatpp::data::mapping::type::Type* type, bool linkSchema, UsedTypes& usedTypes) {
 
   OATPP_ASSERT(type && "[oatpp-swagger::oas3::Generator::generateSchemaForTypeObject()]: Error. Type should not be null.");
 
-  auto result = Schema::createShared();
+  auto result = create<Schema>();
   if(linkSchema) {
   
     result->ref = oatpp::String("#/components/schemas/") + type->nameQualifier;
-    usedTypes[type->nameQualifier] = type;
+    usedTypes.insert(type);
     return result;
   
   } else {
     
     result->type = "object";
-    result->properties = result->properties->createShared();
+    result->properties = createFor(result->properties);
     
     auto properties = type->properties;
     if(properties->getList().size() == 0) {
@@ -64,62 +489,169 @@ Schema::ObjectWrapper Generator::generateSchemaForTypeList(const oatpp::data::ma
 
   OATPP_ASSERT(type && "[oatpp-swagger::oas3::Generator::generateSchemaForTypeList()]: Error. Type should not be null.");
 
-  auto result = Schema::createShared();
+  auto result = create<Schema>();
   result->type = "array";
   result->items = generateSchemaForType(*type->params.begin(), linkSchema, usedTypes);
   return result;
 }
+
+Schema::ObjectWrapper Generator::generateSchemaForTypeMap(const oatpp::data::mapping::type::Type* type, bool linkSchema, UsedTypes& usedTypes) {
+
+  OATPP_ASSERT(type && "[oatpp-swagger::oas3::Generator::generateSchemaForTypeMap()]: Error. Type should not be null.");
+  OATPP_ASSERT(type->params.size() == 2 && "[oatpp-swagger::oas3::Generator::generateSchemaForTypeMap()]: Error. Map type should have key and value params.");
+
+  // JSON object keys are always strings - only the value type is described
+  auto result = create<Schema>();
+  result->type = "object";
+  result->additionalProperties = generateSchemaForType(*std::next(type->params.begin()), linkSchema, usedTypes);
+  return result;
+}
+  
+Schema::ObjectWrapper Generator::createSchemaForType(const oatpp::data::mapping::type::Type* type, bool linkSchema, UsedTypes& usedTypes) {
+
+  OATPP_ASSERT(type && "[oatpp-swagger::oas3::Generator::createSchemaForType()]: Error. Type should not be null.");
+
+  auto it = m_schemaMappers.find(type->name);
+  if(it != m_schemaMappers.end()) {
+    return it->second(*this, type, linkSchema, usedTypes);
+  }
+
+  auto result = create<Schema>();
+  result->type = type->name;
+  if(type->nameQualifier) {
+    result->format = type->nameQualifier;
+  }
+  return result;
   
+}
+
+Generator::SchemaMapper Generator::createPrimitiveMapper(const char* type, const char* format) {
+  return [type, format](Generator& generator, const oatpp::data::mapping::type::Type* t, bool linkSchema, UsedTypes& usedTypes) {
+    auto result = generator.create<Schema>();
+    result->type = type;
+    if(format != nullptr) {
+      result->format = format;
+    }
+    return result;
+  };
+}
+
+Generator::Generator()
+  : m_order(ORDER_REGISTRATION)
+  , m_useArena(false)
+  , m_deduplicate(false)
+  , m_arenaPool(nullptr)
+{
+
+  namespace type = oatpp::data::mapping::type;
+
+  registerSchemaMapper(type::__class::String::CLASS_NAME, createPrimitiveMapper("string", nullptr));
+  registerSchemaMapper(type::__class::Int32::CLASS_NAME, createPrimitiveMapper("integer", "int32"));
+  registerSchemaMapper(type::__class::Int64::CLASS_NAME, createPrimitiveMapper("integer", "int64"));
+  registerSchemaMapper(type::__class::Float32::CLASS_NAME, createPrimitiveMapper("number", "float"));
+  registerSchemaMapper(type::__class::Float64::CLASS_NAME, createPrimitiveMapper("number", "double"));
+  registerSchemaMapper(type::__class::Boolean::CLASS_NAME, createPrimitiveMapper("boolean", nullptr));
+  registerSchemaMapper(oatpp::swagger::__class::Binary::CLASS_NAME, createPrimitiveMapper("string", "binary"));
+
+  registerSchemaMapper(type::__class::AbstractObject::CLASS_NAME,
+                       [](Generator& generator, const type::Type* t, bool linkSchema, UsedTypes& usedTypes) {
+    return generator.generateSchemaForTypeObject(t, linkSchema, usedTypes);
+  });
+
+  registerSchemaMapper(type::__class::AbstractList::CLASS_NAME,
+                       [](Generator& generator, const type::Type* t, bool linkSchema, UsedTypes& usedTypes) {
+    return generator.generateSchemaForTypeList(t, linkSchema, usedTypes);
+  });
+
+  registerSchemaMapper(type::__class::AbstractListMap::CLASS_NAME,
+                       [](Generator& generator, const type::Type* t, bool linkSchema, UsedTypes& usedTypes) {
+    return generator.generateSchemaForTypeMap(t, linkSchema, usedTypes);
+  });
+
+}
+
+Generator::ArenaScope::ArenaScope(Generator* generator, ArenaPool* arenaPool)
+  : m_generator(arenaPool ? generator : nullptr)
+{
+  // generations with arena are serialized. Workers are started after the pool is installed and joined before it is uninstalled
+  if(m_generator) {
+    m_generator->m_arenaPool = arenaPool;
+  }
+}
+
+Generator::ArenaScope::~ArenaScope() {
+  if(m_generator) {
+    m_generator->m_arenaPool = nullptr;
+  }
+}
+
+const std::shared_ptr<Arena>* Generator::getThreadArena() {
+  if(SCHEMA_DEPTH > 0 || m_arenaPool == nullptr) {
+    return nullptr;
+  }
+  return &m_arenaPool->getThreadArena();
+}
+
+oatpp::String Generator::getStatusCode(v_int32 code) {
+  std::lock_guard<std::mutex> lock(m_cacheLock);
+  auto& result = m_statusCodes[code];
+  if(!result) {
+    result = oatpp::utils::conversion::int32ToStr(code);
+  }
+  return result;
+}
+
+void Generator::registerSchemaMapper(const char* classId, const SchemaMapper& mapper) {
+  OATPP_ASSERT(classId && "[oatpp-swagger::oas3::Generator::registerSchemaMapper()]: Error. Class id should not be null.");
+  m_schemaMappers[classId] = mapper;
+  clearCache();
+}
+
+std::shared_ptr<Generator> Generator::createCopy() const {
+  auto result = createShared();
+  result->m_schemaMappers = m_schemaMappers;
+  result->m_order = m_order;
+  result->m_useArena = m_useArena;
+  result->m_deduplicate = m_deduplicate;
+  return result;
+}
+
+void Generator::addUsedTypes(const std::vector<TypeSet::TypePtr>& types, UsedTypes& usedTypes) {
+  for(TypeSet::TypePtr type : types) {
+    usedTypes.insert(type);
+  }
+}
+
 Schema::ObjectWrapper Generator::generateSchemaForType(const oatpp::data::mapping::type::Type* type, bool linkSchema, UsedTypes& usedTypes) {
 
   OATPP_ASSERT(type && "[oatpp-swagger::oas3::Generator::generateSchemaForType()]: Error. Type should not be null.");
 
-  auto typeName = type->name;
-  if(typeName == oatpp::data::mapping::type::__class::String::CLASS_NAME){
-    auto result = Schema::createShared();
-    result->type = "string";
-    return result;
-  } else if(typeName == oatpp::data::mapping::type::__class::Int32::CLASS_NAME){
-    auto result = Schema::createShared();
-    result->type = "integer";
-    result->format = "int32";
-    return result;
-  } else if(typeName == oatpp::data::mapping::type::__class::Int64::CLASS_NAME){
-    auto result = Schema::createShared();
-    result->type = "integer";
-    result->format = "int64";
-    return result;
-  } else if(typeName == oatpp::data::mapping::type::__class::Float32::CLASS_NAME){
-    auto result = Schema::createShared();
-    result->type = "number";
-    result->format = "float";
-    return result;
-  } else if(typeName == oatpp::data::mapping::type::__class::Float64::CLASS_NAME){
-    auto result = Schema::createShared();
-    result->type = "number";
-    result->format = "double";
-    return result;
-  } else if(typeName == oatpp::data::mapping::type::__class::Boolean::CLASS_NAME){
-    auto result = Schema::createShared();
-    result->type = "boolean";
-    return result;
-  } else if(typeName == oatpp::data::mapping::type::__class::AbstractObject::CLASS_NAME){
-    return generateSchemaForTypeObject(type, linkSchema, usedTypes);
-  } else if(typeName == oatpp::data::mapping::type::__class::AbstractList::CLASS_NAME){
-    return generateSchemaForTypeList(type, linkSchema, usedTypes);
-  } else if(typeName == oatpp::data::mapping::type::__class::AbstractListMap::CLASS_NAME){
-    // TODO
-  } else {
-    auto result = Schema::createShared();
-    result->type = type->name;
-    if(type->nameQualifier) {
-      result->format = type->nameQualifier;
+  SchemaCache& cache = linkSchema ? m_linkedSchemas : m_schemas;
+
+  {
+    std::lock_guard<std::mutex> lock(m_cacheLock);
+    auto it = cache.find(type);
+    if(it != cache.end()) {
+      addUsedTypes(it->second.usedTypes, usedTypes);
+      return it->second.schema;
     }
-    return result;
   }
-  
-  return Schema::createShared();
-  
+
+  // not holding the lock here - nested types are resolved through the cache as well.
+  UsedTypes localTypes;
+  CachedSchema entry;
+  {
+    SchemaScope schemaScope;
+    entry.schema = createSchemaForType(type, linkSchema, localTypes);
+  }
+  entry.usedTypes = localTypes.getTypes();
+
+  addUsedTypes(entry.usedTypes, usedTypes);
+
+  std::lock_guard<std::mutex> lock(m_cacheLock);
+  auto result = cache.insert(std::make_pair(type, entry));
+  return result.first->second.schema;
+
 }
 
 void Generator::addParamsToParametersList(const PathItemParameters::ObjectWrapper& paramsList,
@@ -131,7 +663,7 @@ void Generator::addParamsToParametersList(const PathItemParameters::ObjectWrappe
   auto it = params.getOrder().begin();
   while (it != params.getOrder().end()) {
     auto param = params[*it++];
-    auto parameter = PathItemParameter::createShared();
+    auto parameter = create<PathItemParameter>();
     parameter->in = inType;
     parameter->name = param.name;
     parameter->description = param.description;
@@ -147,14 +679,14 @@ RequestBody::ObjectWrapper Generator::generateRequestBody(const Endpoint::Info&
 
   if(endpointInfo.consumes.size() > 0) {
 
-    auto body = RequestBody::createShared();
-    body->description = "request body";
-    body->content = body->content->createShared();
+    auto body = create<RequestBody>();
+    body->description = m_strings.requestBody;
+    body->content = createFor(body->content);
     
     auto it = endpointInfo.consumes.begin();
     while (it != endpointInfo.consumes.end()) {
       
-      auto mediaType = MediaTypeObject::createShared();
+      auto mediaType = create<MediaTypeObject>();
       mediaType->schema = generateSchemaForType(it->schema, linkSchema, usedTypes);
       
       body->content->put(it->contentType, mediaType);
@@ -168,13 +700,13 @@ RequestBody::ObjectWrapper Generator::generateRequestBody(const Endpoint::Info&
   
     if(endpointInfo.body.name != nullptr && endpointInfo.body.type != nullptr) {
 
-      auto body = RequestBody::createShared();
-      body->description = "request body";
+      auto body = create<RequestBody>();
+      body->description = m_strings.requestBody;
       
-      auto mediaType = MediaTypeObject::createShared();
+      auto mediaType = create<MediaTypeObject>();
       mediaType->schema = generateSchemaForType(endpointInfo.body.type, linkSchema, usedTypes);
       
-      body->content = body->content->createShared();
+      body->content = createFor(body->content);
       if(endpointInfo.bodyContentType != nullptr) {
         body->content->put(endpointInfo.bodyContentType, mediaType);
       } else {
@@ -182,13 +714,13 @@ RequestBody::ObjectWrapper Generator::generateRequestBody(const Endpoint::Info&
         OATPP_ASSERT(endpointInfo.body.type && "[oatpp-swagger::oas3::Generator::generateRequestBody()]: Error. Type should not be null.");
 
         if(endpointInfo.body.type->name == oatpp::data::mapping::type::__class::AbstractObject::CLASS_NAME) {
-          body->content->put("application/json", mediaType);
+          body->content->put(m_strings.applicationJson, mediaType);
         } else if(endpointInfo.body.type->name == oatpp::data::mapping::type::__class::AbstractList::CLASS_NAME) {
-          body->content->put("application/json", mediaType);
+          body->content->put(m_strings.applicationJson, mediaType);
         } else if(endpointInfo.body.type->name == oatpp::data::mapping::type::__class::AbstractListMap::CLASS_NAME) {
-          body->content->put("application/json", mediaType);
+          body->content->put(m_strings.applicationJson, mediaType);
         } else {
-          body->content->put("text/plain", mediaType);
+          body->content->put(m_strings.textPlain, mediaType);
         }
       }
 
@@ -204,35 +736,43 @@ RequestBody::ObjectWrapper Generator::generateRequestBody(const Endpoint::Info&
 
 Generator::Fields<OperationResponse::ObjectWrapper>::ObjectWrapper Generator::generateResponses(const Endpoint::Info& endpointInfo, bool linkSchema, UsedTypes& usedTypes) {
   
-  auto responses = Fields<OperationResponse::ObjectWrapper>::createShared();
+  auto responses = create<Fields<OperationResponse::ObjectWrapper>>();
   
   if(endpointInfo.responses.size() > 0) {
-    
-    auto it = endpointInfo.responses.begin();
-    while (it != endpointInfo.responses.end()) {
+
+    // responses are kept in a hash map - order them by status code
+    typedef decltype(endpointInfo.responses.begin()) ResponseIterator;
+    std::vector<ResponseIterator> sorted;
+    for(auto it = endpointInfo.responses.begin(); it != endpointInfo.responses.end(); it ++) {
+      sorted.push_back(it);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](ResponseIterator a, ResponseIterator b) {
+      return a->first.code < b->first.code;
+    });
+
+    for(auto it : sorted) {
       
-      auto mediaType = MediaTypeObject::createShared();
+      auto mediaType = create<MediaTypeObject>();
       mediaType->schema = generateSchemaForType(it->second.schema, linkSchema, usedTypes);
       
-      auto response = OperationResponse::createShared();
+      auto response = create<OperationResponse>();
       response->description = it->first.description;
-      response->content = response->content->createShared();
+      response->content = createFor(response->content);
       response->content->put(it->second.contentType, mediaType);
-      responses->put(oatpp::utils::conversion::int32ToStr(it->first.code), response);
-      
-      it++;
+      responses->put(getStatusCode(it->first.code), response);
+
     }
     
   } else {
   
-    auto mediaType = MediaTypeObject::createShared();
+    auto mediaType = create<MediaTypeObject>();
     mediaType->schema = generateSchemaForType(oatpp::String::Class::getType(), linkSchema, usedTypes);
   
-    auto response = OperationResponse::createShared();
-    response->description = "success";
-    response->content = response->content->createShared();
-    response->content->put("text/plain", mediaType);
-    responses->put("200", response);
+    auto response = create<OperationResponse>();
+    response->description = m_strings.success;
+    response->content = createFor(response->content);
+    response->content->put(m_strings.textPlain, mediaType);
+    responses->put(getStatusCode(200), response);
   
   }
   
@@ -246,27 +786,15 @@ void Generator::generatePathItemData(const std::shared_ptr<Endpoint>& endpoint,
   
   if(info) {
     
-    auto operation = PathItemOperation::createShared();
+    auto operation = create<PathItemOperation>();
     operation->operationId = info->name;
     operation->summary = info->summary;
     operation->description = info->description;
+    copyEndpointTags(*this, *info, operation, 0);
     
-    if(oatpp::base::StrBuffer::equalsCI("get", info->method->c_str(), info->method->getSize())) {
-      pathItem->operationGet = operation;
-    } else if(oatpp::base::StrBuffer::equalsCI("put", info->method->c_str(), info->method->getSize())) {
-      pathItem->operationPut = operation;
-    } else if(oatpp::base::StrBuffer::equalsCI("post", info->method->c_str(), info->method->getSize())) {
-      pathItem->operationPost = operation;
-    } else if(oatpp::base::StrBuffer::equalsCI("delete", info->method->c_str(), info->method->getSize())) {
-      pathItem->operationDelete = operation;
-    } else if(oatpp::base::StrBuffer::equalsCI("options", info->method->c_str(), info->method->getSize())) {
-      pathItem->operationOptions = operation;
-    } else if(oatpp::base::StrBuffer::equalsCI("head", info->method->c_str(), info->method->getSize())) {
-      pathItem->operationHead = operation;
-    } else if(oatpp::base::StrBuffer::equalsCI("patch", info->method->c_str(), info->method->getSize())) {
-      pathItem->operationPatch = operation;
-    } else if(oatpp::base::StrBuffer::equalsCI("trace", info->method->c_str(), info->method->getSize())) {
-      pathItem->operationTrace = operation;
+    auto method = findMethod(info->method);
+    if(method) {
+      (pathItem.getPtr().get())->*(method->field) = operation;
     }
     
     operation->responses = generateResponses(*info, true, usedTypes);
@@ -274,7 +802,7 @@ void Generator::generatePathItemData(const std::shared_ptr<Endpoint>& endpoint,
 
     if(!operation->parameters) {
 
-      operation->parameters = operation->parameters->createShared();
+      operation->parameters = createFor(operation->parameters);
 
       Endpoint::Info::Params filteredHeaders;
       if(!info->headers.getOrder().empty()) {
@@ -286,9 +814,9 @@ void Generator::generatePathItemData(const std::shared_ptr<Endpoint>& endpoint,
         }
       }
 
-      addParamsToParametersList(operation->parameters, filteredHeaders, "header", usedTypes);
-      addParamsToParametersList(operation->parameters, info->pathParams, "path", usedTypes);
-      addParamsToParametersList(operation->parameters, info->queryParams, "query", usedTypes);
+      addParamsToParametersList(operation->parameters, filteredHeaders, m_strings.inHeader, usedTypes);
+      addParamsToParametersList(operation->parameters, info->pathParams, m_strings.inPath, usedTypes);
+      addParamsToParametersList(operation->parameters, info->queryParams, m_strings.inQuery, usedTypes);
 
     }
 
@@ -301,22 +829,24 @@ void Generator::generatePathItemData(const std::shared_ptr<Endpoint>& endpoint,
 
       if (!info->securityRequirements.empty()) {
 
-        operation->security = operation->security->createShared();
+        operation->security = createFor(operation->security);
 
-        for (const auto &sec : info->securityRequirements) {
+        // requirements are kept in a hash map - order them by name
+        for (const auto &name : getSortedKeys(info->securityRequirements)) {
 
+          const auto &sec = *info->securityRequirements.find(name);
           usedSecuritySchemes[sec.first] = true;
           if (sec.second == nullptr) {
 
             // who ever came up to define "security" as an array of objects of array of strings
-            auto fields = Fields<Components::List<String>::ObjectWrapper>::createShared();
-            fields->put(sec.first, Components::List<String>::createShared());
+            auto fields = create<Fields<Components::List<String>::ObjectWrapper>>();
+            fields->put(sec.first, create<Components::List<String>>());
             operation->security->pushBack(fields);
 
           } else {
 
-            auto fields = Fields<Components::List<String>::ObjectWrapper>::createShared();
-            auto sro = Components::List<String>::createShared();
+            auto fields = create<Fields<Components::List<String>::ObjectWrapper>>();
+            auto sro = create<Components::List<String>>();
             for (const auto &sr : *sec.second) {
               sro->pushBack(sr);
             }
@@ -330,26 +860,42 @@ void Generator::generatePathItemData(const std::shared_ptr<Endpoint>& endpoint,
   }
 }
   
+oatpp::String Generator::getEndpointPath(const std::shared_ptr<Endpoint>& endpoint) {
+
+  if(!endpoint->info() || endpoint->info()->hide) {
+    return nullptr;
+  }
+
+  oatpp::String path = endpoint->info()->path;
+  if(!path || path->getSize() == 0) {
+    return nullptr;
+  }
+  if(path->getData()[0] != '/') {
+    path = "/" + path;
+  }
+
+  return path;
+
+}
+
 Generator::Paths::ObjectWrapper Generator::generatePaths(const std::shared_ptr<Endpoints>& endpoints, UsedTypes& usedTypes, UsedSecuritySchemes &usedSecuritySchemes) {
   
-  auto result = Paths::createShared();
+  auto result = create<Paths>();
+
+  // ListMap lookup is a linear walk - path items of already seen paths are found through the index,
+  // so each distinct path goes through ListMap::put() only once
+  std::unordered_map<oatpp::String, PathItem::ObjectWrapper> pathIndex;
   
   auto curr = endpoints->getFirstNode();
   while (curr != nullptr) {
     auto endpoint = curr->getData();
-    
-    if(endpoint->info() && !endpoint->info()->hide) {
-      oatpp::String path = endpoint->info()->path;
-      if(path->getSize() == 0) {
-        continue;
-      }
-      if(path->getData()[0] != '/') {
-        path = "/" + path;
-      }
+    auto path = getEndpointPath(endpoint);
+
+    if(path) {
 
-      auto pathItem = result->get(path, nullptr);
+      auto& pathItem = pathIndex[path];
       if(!pathItem) {
-        pathItem = PathItem::createShared();
+        pathItem = create<PathItem>();
         result->put(path, pathItem);
       }
 
@@ -362,85 +908,241 @@ Generator::Paths::ObjectWrapper Generator::generatePaths(const std::shared_ptr<E
   return result;
   
 }
-  
-void Generator::decomposeObject(const oatpp::data::mapping::type::Type* type, UsedTypes& decomposedTypes) {
 
-  OATPP_ASSERT(type && "[oatpp-swagger::oas3::Generator::decomposeObject()]: Error. Type should not be null.");
+void Generator::runWorkers(v_int32 workers, v_int32 count, const std::function<void(v_int32 worker, v_int32 index)>& task) {
 
-  auto schemaIt = decomposedTypes.find(type->nameQualifier);
-  if(schemaIt != decomposedTypes.end()) {
-    return;
+  if(workers > count) {
+    workers = count;
   }
-  
-  decomposedTypes[type->nameQualifier] = type;
-  
-  auto properties = type->properties;
-  if(properties->getList().size() == 0) {
-    type->creator(); // init type by creating first instance of that type
+
+  std::atomic<v_int32> nextIndex(0);
+  std::mutex errorLock;
+  std::exception_ptr error;
+
+  auto work = [&](v_int32 worker) {
+    try {
+      v_int32 index;
+      while((index = nextIndex.fetch_add(1)) < count) {
+        task(worker, index);
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(errorLock);
+      if(!error) {
+        error = std::current_exception();
+      }
+      nextIndex = count;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for(v_int32 i = 1; i < workers; i ++) {
+    threads.push_back(std::thread(work, i));
   }
-  
-  auto it = properties->getList().begin();
-  while (it != properties->getList().end()) {
-    auto p = *it ++;
-    decomposeType(p->type, decomposedTypes);
+  work(0);
+
+  for(auto& thread : threads) {
+    thread.join();
+  }
+
+  if(error) {
+    std::rethrow_exception(error);
   }
+
 }
 
-void Generator::decomposeList(const oatpp::data::mapping::type::Type* type, UsedTypes& decomposedTypes) {
-  OATPP_ASSERT(type && "[oatpp-swagger::oas3::Generator::decomposeList()]: Error. Type should not be null.");
-  decomposeType(*type->params.begin(), decomposedTypes);
+void Generator::collectSecuritySchemes(const PathItemOperation::ObjectWrapper& operation, UsedSecuritySchemes& usedSecuritySchemes) {
+  if(operation && operation->security) {
+    auto curr = operation->security->getFirstNode();
+    while(curr != nullptr) {
+      auto requirement = curr->getData()->getFirstEntry();
+      while(requirement != nullptr) {
+        usedSecuritySchemes[requirement->getKey()] = true;
+        requirement = requirement->getNext();
+      }
+      curr = curr->getNext();
+    }
+  }
 }
 
-void Generator::decomposeMap(const oatpp::data::mapping::type::Type* type, UsedTypes& decomposedTypes) {
-  // TODO
+void Generator::mergePathItem(const PathItem::ObjectWrapper& from, const PathItem::ObjectWrapper& to, UsedSecuritySchemes& usedSecuritySchemes) {
+
+  for(const Method& method : METHODS) {
+    auto& operation = (from.getPtr().get())->*(method.field);
+    if(operation) {
+      (to.getPtr().get())->*(method.field) = operation;
+      collectSecuritySchemes(operation, usedSecuritySchemes);
+    }
+  }
+
 }
-  
-void Generator::decomposeType(const oatpp::data::mapping::type::Type* type, UsedTypes& decomposedTypes) {
-  OATPP_ASSERT(type && "[oatpp-swagger::oas3::Generator::decomposeType()]: Error. Type should not be null.");
-  auto typeName = type->name;
-  if(typeName == oatpp::data::mapping::type::__class::AbstractObject::CLASS_NAME){
-    decomposeObject(type, decomposedTypes);
-  } else if(typeName == oatpp::data::mapping::type::__class::AbstractList::CLASS_NAME){
-    decomposeList(type, decomposedTypes);
-  } else if(typeName == oatpp::data::mapping::type::__class::AbstractListMap::CLASS_NAME){
-    decomposeMap(type, decomposedTypes);
+
+Generator::Paths::ObjectWrapper Generator::generatePathsParallel(const std::shared_ptr<Endpoints>& endpoints,
+                                                                 v_int32 workers,
+                                                                 UsedTypes& usedTypes,
+                                                                 UsedSecuritySchemes &usedSecuritySchemes)
+{
+
+  // Endpoint::info() may be built lazily, so paths are resolved on the calling thread.
+  std::vector<std::shared_ptr<Endpoint>> endpointsVector;
+  std::vector<oatpp::String> paths;
+  auto curr = endpoints->getFirstNode();
+  while (curr != nullptr) {
+    endpointsVector.push_back(curr->getData());
+    paths.push_back(getEndpointPath(curr->getData()));
+    curr = curr->getNext();
   }
+
+  // each endpoint gets its own PathItem and UsedTypes - endpoints sharing the same path are merged afterwards.
+  std::vector<PathItem::ObjectWrapper> pathItems(endpointsVector.size());
+  std::vector<UsedTypes> endpointTypes(endpointsVector.size());
+  std::vector<UsedSecuritySchemes> workerSecuritySchemes(workers);
+
+  runWorkers(workers, (v_int32) endpointsVector.size(), [&](v_int32 worker, v_int32 index) {
+    if(paths[index]) {
+      auto pathItem = create<PathItem>();
+      generatePathItemData(endpointsVector[index], pathItem, endpointTypes[index], workerSecuritySchemes[worker]);
+      pathItems[index] = pathItem;
+    }
+  });
+
+  auto result = create<Paths>();
+  std::unordered_map<oatpp::String, PathItem::ObjectWrapper> pathIndex;
+
+  for(size_t i = 0; i < endpointsVector.size(); i ++) {
+
+    if(!paths[i]) {
+      continue;
+    }
+
+    auto& pathItem = pathIndex[paths[i]];
+    if(!pathItem) {
+      pathItem = create<PathItem>();
+      result->put(paths[i], pathItem);
+    }
+
+    usedTypes.insertAll(endpointTypes[i]);
+    mergePathItem(pathItems[i], pathItem, usedSecuritySchemes);
+
+  }
+
+  return result;
+
 }
   
-Generator::UsedTypes Generator::decomposeTypes(UsedTypes& usedTypes) {
-  
+Generator::UsedTypes Generator::decomposeTypes(const UsedTypes& usedTypes, DecompositionStats& stats) {
+
+  namespace type_ns = oatpp::data::mapping::type;
+
+  struct Item {
+    TypeSet::TypePtr type;
+    v_int32 depth;
+  };
+
   UsedTypes result; // decomposed schemas
-  
-  auto it = usedTypes.begin();
-  while (it != usedTypes.end()) {
-    decomposeType(it->second, result);
-    result[it->first] = it->second;
-    it ++;
+  TypeSet visited;
+
+  // breadth-first worklist instead of recursion - DTO graphs may be deeper than the stack of the generating thread.
+  std::vector<Item> queue;
+  for(TypeSet::TypePtr type : usedTypes) {
+    if(visited.insert(type)) {
+      queue.push_back({type, 0});
+    }
   }
-  
+
+  stats = DecompositionStats();
+
+  for(size_t i = 0; i < queue.size(); i ++) {
+
+    auto item = queue[i];
+    auto type = item.type;
+    OATPP_ASSERT(type && "[oatpp-swagger::oas3::Generator::decomposeTypes()]: Error. Type should not be null.");
+
+    if(item.depth > stats.maxDepth) {
+      stats.maxDepth = item.depth;
+    }
+
+    if(type->name == type_ns::__class::AbstractObject::CLASS_NAME) {
+
+      result.insert(type);
+
+      auto properties = type->properties;
+      if(properties->getList().size() == 0) {
+        type->creator(); // init type by creating first instance of that type
+      }
+
+      for(auto p : properties->getList()) {
+        if(visited.insert(p->type)) {
+          queue.push_back({p->type, item.depth + 1});
+        }
+      }
+
+    } else {
+
+      if(item.depth == 0) {
+        result.insert(type);
+      }
+
+      if(type->name == type_ns::__class::AbstractList::CLASS_NAME) {
+        auto param = *type->params.begin();
+        if(visited.insert(param)) {
+          queue.push_back({param, item.depth + 1});
+        }
+      } else if(type->name == type_ns::__class::AbstractListMap::CLASS_NAME) {
+        // keys are strings in JSON - only values may reference other objects
+        auto param = *std::next(type->params.begin());
+        if(visited.insert(param)) {
+          queue.push_back({param, item.depth + 1});
+        }
+      }
+
+    }
+
+  }
+
+  stats.typesCount = visited.size();
+  stats.objectsCount = result.size();
+
   return result;
-  
+
 }
-  
+
 Components::ObjectWrapper Generator::generateComponents(const UsedTypes &decomposedTypes,
                                                         const std::shared_ptr<std::unordered_map<oatpp::String,std::shared_ptr<oatpp::swagger::SecurityScheme>>> &securitySchemes,
-                                                        UsedSecuritySchemes &usedSecuritySchemes) {
+                                                        UsedSecuritySchemes &usedSecuritySchemes,
+                                                        v_int32 workers) {
   
-  auto result = Components::createShared();
-  result->schemas = result->schemas->createShared();
+  auto result = create<Components>();
+  result->schemas = createFor(result->schemas);
   
-  auto it = decomposedTypes.begin();
-  while (it != decomposedTypes.end()) {
-    UsedTypes schemas; ///< dummy
-    result->schemas->put(it->first, generateSchemaForType(it->second, false, schemas));
-    it ++;
+  // Types are identified by pointer, so different types may still share the same name qualifier - first one wins.
+  std::vector<TypeSet::TypePtr> types;
+  std::unordered_map<oatpp::String, TypeSet::TypePtr> names;
+  for(TypeSet::TypePtr type : decomposedTypes) {
+    auto it = names.find(type->nameQualifier);
+    if(it == names.end()) {
+      names[type->nameQualifier] = type;
+      types.push_back(type);
+    } else if(it->second != type) {
+      OATPP_LOGW("[oatpp-swagger::oas3::Generator::generateComponents()]", "Warning. Schema name '%s' is used by different types.", type->nameQualifier);
+    }
+  }
+
+  // types are already initialized by decomposeTypes() so schemas can be generated concurrently.
+  std::vector<Schema::ObjectWrapper> schemas(types.size());
+  runWorkers(workers, (v_int32) types.size(), [&](v_int32 worker, v_int32 index) {
+    UsedTypes dummy;
+    schemas[index] = generateSchemaForType(types[index], false, dummy);
+  });
+
+  for(size_t i = 0; i < types.size(); i ++) {
+    result->schemas->put(types[i]->nameQualifier, schemas[i]);
   }
 
   if(securitySchemes) {
-    result->securitySchemes = result->securitySchemes->createShared();
-    for (const auto &ss : usedSecuritySchemes) {
-        OATPP_ASSERT(securitySchemes->find(ss.first) != securitySchemes->end() && "[oatpp-swagger::oas3::Generator::generateComponents()]: Error. Requested unknown security requirement.");
-        result->securitySchemes->put(ss.first, generateSecurityScheme(securitySchemes->at(ss.first)));
+    result->securitySchemes = createFor(result->securitySchemes);
+    for (const auto &name : getSortedKeys(usedSecuritySchemes)) {
+        OATPP_ASSERT(securitySchemes->find(name) != securitySchemes->end() && "[oatpp-swagger::oas3::Generator::generateComponents()]: Error. Requested unknown security requirement.");
+        result->securitySchemes->put(name, generateSecurityScheme(securitySchemes->at(name)));
     }
   }
 
@@ -448,30 +1150,339 @@ Components::ObjectWrapper Generator::generateComponents(const UsedTypes &decompo
   
 }
   
-Document::ObjectWrapper Generator::generateDocument(const std::shared_ptr<oatpp::swagger::DocumentInfo>& docInfo, const std::shared_ptr<Endpoints>& endpoints) {
+Document::ObjectWrapper Generator::generate(const std::shared_ptr<oatpp::swagger::DocumentInfo>& docInfo,
+                                            const std::shared_ptr<Endpoints>& endpoints,
+                                            v_int32 workers)
+{
+
+  std::unique_lock<std::mutex> generateLock(m_generateLock, std::defer_lock);
+  std::unique_ptr<ArenaPool> arenaPool;
+  if(m_useArena) {
+    generateLock.lock();
+    arenaPool.reset(new ArenaPool());
+  }
+  ArenaScope arenaScope(this, arenaPool.get());
   
-  auto document = oas3::Document::createShared();
+  auto document = create<oas3::Document>();
   document->info = Info::createFromBaseModel(docInfo->header);
   
   if(docInfo->servers) {
-    document->servers = document->servers->createShared();
+    document->servers = createFor(document->servers);
 
     for(const auto &it : *docInfo->servers) {
-      document->servers->pushBack(Server::createFromBaseModel(it));
+      auto server = Server::createFromBaseModel(it);
+      if(server) {
+        // variables are kept in a hash map
+        server->variables = sortFields<ServerVariable::ObjectWrapper>(server->variables);
+      }
+      document->servers->pushBack(server);
     }
 
   }
   
   UsedTypes usedTypes;
   UsedSecuritySchemes usedSecuritySchemes;
-  document->paths = generatePaths(endpoints, usedTypes, usedSecuritySchemes);
-  auto decomposedTypes = decomposeTypes(usedTypes);
-  document->components = generateComponents(decomposedTypes, docInfo->securitySchemes, usedSecuritySchemes);
+  if(workers > 1) {
+    document->paths = generatePathsParallel(endpoints, workers, usedTypes, usedSecuritySchemes);
+  } else {
+    document->paths = generatePaths(endpoints, usedTypes, usedSecuritySchemes);
+  }
+  DecompositionStats stats;
+  auto decomposedTypes = decomposeTypes(usedTypes, stats);
+  {
+    std::lock_guard<std::mutex> lock(m_cacheLock);
+    m_decompositionStats = stats;
+  }
+  document->components = generateComponents(decomposedTypes, docInfo->securitySchemes, usedSecuritySchemes, workers);
+
+  if(m_order == ORDER_SORTED) {
+    sortDocument(document);
+  }
+
+  if(m_deduplicate) {
+    return Deduplicator::deduplicate(document);
+  }
 
   return document;
   
 }
 
+PathItem::ObjectWrapper Generator::copyPathItem(const PathItem::ObjectWrapper& pathItem) {
+  auto result = create<PathItem>();
+  for(const Method& method : METHODS) {
+    (result.getPtr().get())->*(method.field) = (pathItem.getPtr().get())->*(method.field);
+  }
+  return result;
+}
+
+Document::ObjectWrapper Generator::extend(const std::shared_ptr<oatpp::swagger::DocumentInfo>& docInfo,
+                                          const Document::ObjectWrapper& document,
+                                          const std::shared_ptr<Endpoints>& endpoints,
+                                          v_int32 workers)
+{
+
+  OATPP_ASSERT(document && "[oatpp-swagger::oas3::Generator::extend()]: Error. Document should not be null.");
+
+  std::unique_lock<std::mutex> generateLock(m_generateLock, std::defer_lock);
+  std::unique_ptr<ArenaPool> arenaPool;
+  if(m_useArena) {
+    generateLock.lock();
+    arenaPool.reset(new ArenaPool());
+  }
+  ArenaScope arenaScope(this, arenaPool.get());
+
+  UsedTypes usedTypes;
+  UsedSecuritySchemes usedSecuritySchemes;
+  Paths::ObjectWrapper newPaths;
+  if(workers > 1) {
+    newPaths = generatePathsParallel(endpoints, workers, usedTypes, usedSecuritySchemes);
+  } else {
+    newPaths = generatePaths(endpoints, usedTypes, usedSecuritySchemes);
+  }
+
+  // Document parts are shared - unchanged path items and schemas are reused as-is, merged path items are copied.
+  auto result = create<oas3::Document>();
+  result->openapi = document->openapi;
+  result->info = document->info;
+  result->servers = document->servers;
+  result->paths = create<Paths>();
+
+  std::unordered_map<oatpp::String, PathItem::ObjectWrapper> addedPaths;
+  auto curr = newPaths->getFirstEntry();
+  while (curr != nullptr) {
+    addedPaths[curr->getKey()] = curr->getValue();
+    curr = curr->getNext();
+  }
+
+  if(document->paths) {
+    auto entry = document->paths->getFirstEntry();
+    while (entry != nullptr) {
+      auto it = addedPaths.find(entry->getKey());
+      if(it != addedPaths.end()) {
+        auto merged = copyPathItem(entry->getValue());
+        mergePathItem(it->second, merged, usedSecuritySchemes);
+        result->paths->put(entry->getKey(), merged);
+        addedPaths.erase(it);
+      } else {
+        result->paths->put(entry->getKey(), entry->getValue());
+      }
+      entry = entry->getNext();
+    }
+  }
+
+  curr = newPaths->getFirstEntry();
+  while (curr != nullptr) {
+    if(addedPaths.find(curr->getKey()) != addedPaths.end()) {
+      result->paths->put(curr->getKey(), curr->getValue());
+    }
+    curr = curr->getNext();
+  }
+
+  // only schemas and security schemes which are not in the document yet are generated
+  auto components = document->components;
+  std::unordered_set<oatpp::String> existingNames;
+  if(components && components->schemas) {
+    auto entry = components->schemas->getFirstEntry();
+    while (entry != nullptr) {
+      existingNames.insert(entry->getKey());
+      entry = entry->getNext();
+    }
+  }
+
+  UsedTypes newTypes;
+  DecompositionStats stats;
+  auto decomposedTypes = decomposeTypes(usedTypes, stats);
+  {
+    std::lock_guard<std::mutex> lock(m_cacheLock);
+    m_decompositionStats = stats;
+  }
+
+  for(TypeSet::TypePtr type : decomposedTypes) {
+    if(existingNames.find(type->nameQualifier) == existingNames.end()) {
+      newTypes.insert(type);
+    }
+  }
+
+  existingNames.clear();
+  if(components && components->securitySchemes) {
+    auto entry = components->securitySchemes->getFirstEntry();
+    while (entry != nullptr) {
+      existingNames.insert(entry->getKey());
+      entry = entry->getNext();
+    }
+  }
+
+  UsedSecuritySchemes newSecuritySchemes;
+  for(const auto& ss : usedSecuritySchemes) {
+    if(existingNames.find(ss.first) == existingNames.end()) {
+      newSecuritySchemes[ss.first] = true;
+    }
+  }
+
+  auto newComponents = generateComponents(newTypes, docInfo->securitySchemes, newSecuritySchemes, workers);
+
+  result->components = create<Components>();
+  result->components->schemas = createFor(result->components->schemas);
+  if(components && components->schemas) {
+    auto entry = components->schemas->getFirstEntry();
+    while (entry != nullptr) {
+      result->components->schemas->put(entry->getKey(), entry->getValue());
+      entry = entry->getNext();
+    }
+  }
+  auto schema = newComponents->schemas->getFirstEntry();
+  while (schema != nullptr) {
+    result->components->schemas->put(schema->getKey(), schema->getValue());
+    schema = schema->getNext();
+  }
+
+  if(components) {
+    result->components->responses = components->responses;
+  }
+
+  if(components && components->securitySchemes) {
+    result->components->securitySchemes = createFor(result->components->securitySchemes);
+    auto entry = components->securitySchemes->getFirstEntry();
+    while (entry != nullptr) {
+      result->components->securitySchemes->put(entry->getKey(), entry->getValue());
+      entry = entry->getNext();
+    }
+  }
+  if(newComponents->securitySchemes && newComponents->securitySchemes->count() > 0) {
+    if(!result->components->securitySchemes) {
+      result->components->securitySchemes = createFor(result->components->securitySchemes);
+    }
+    auto entry = newComponents->securitySchemes->getFirstEntry();
+    while (entry != nullptr) {
+      result->components->securitySchemes->put(entry->getKey(), entry->getValue());
+      entry = entry->getNext();
+    }
+  }
+
+  result->components->securitySchemes = sortFields<SecurityScheme::ObjectWrapper>(result->components->securitySchemes);
+
+  if(m_order == ORDER_SORTED) {
+    sortDocument(result);
+  }
+
+  if(m_deduplicate) {
+    return Deduplicator::deduplicate(result);
+  }
+
+  return result;
+
+}
+
+v_int64 Generator::getCacheSize() {
+  std::lock_guard<std::mutex> lock(m_cacheLock);
+  return m_linkedSchemas.size() + m_schemas.size();
+}
+
+Generator::DecompositionStats Generator::getDecompositionStats() {
+  std::lock_guard<std::mutex> lock(m_cacheLock);
+  return m_decompositionStats;
+}
+
+oatpp::String Generator::computeFingerprint(const std::shared_ptr<oatpp::swagger::DocumentInfo>& docInfo,
+                                            const std::shared_ptr<Endpoints>& endpoints)
+{
+
+  FingerprintHash hash;
+  hash.updateString(FINGERPRINT_VERSION);
+
+  hashDocumentInfo(hash, docInfo);
+
+  // types are hashed in full once per endpoint, so the result doesn't depend on which endpoint saw a type first
+  auto curr = endpoints->getFirstNode();
+  while (curr != nullptr) {
+    auto info = curr->getData()->info();
+    if(info) {
+      std::unordered_set<const oatpp::data::mapping::type::Type*> visited;
+      hashEndpointInfo(hash, *info, visited);
+    } else {
+      hash.updateInt(-1);
+    }
+    curr = curr->getNext();
+  }
+
+  char buffer[32];
+  auto length = std::snprintf(buffer, sizeof(buffer), "%016llx", (unsigned long long) hash.get());
+  return oatpp::String(buffer, (v_buff_size) length, true);
+
+}
+
+void Generator::setUseArena(bool useArena) {
+  m_useArena = useArena;
+}
+
+bool Generator::isUseArena() const {
+  return m_useArena;
+}
+
+void Generator::setDeduplicate(bool deduplicate) {
+  m_deduplicate = deduplicate;
+}
+
+bool Generator::isDeduplicate() const {
+  return m_deduplicate;
+}
+
+void Generator::setOrder(Order order) {
+  m_order = order;
+}
+
+Generator::Order Generator::getOrder() const {
+  return m_order;
+}
+
+void Generator::sortDocument(const Document::ObjectWrapper& document) {
+  document->paths = sortFields<PathItem::ObjectWrapper>(document->paths);
+  if(document->components) {
+    document->components->schemas = sortFields<Schema::ObjectWrapper>(document->components->schemas);
+  }
+}
+
+void Generator::clearCache() {
+  std::lock_guard<std::mutex> lock(m_cacheLock);
+  m_linkedSchemas.clear();
+  m_schemas.clear();
+}
+
+Document::ObjectWrapper Generator::generateDocument(const std::shared_ptr<oatpp::swagger::DocumentInfo>& docInfo, const std::shared_ptr<Endpoints>& endpoints) {
+  return generateDocument(docInfo, endpoints, 1);
+}
+
+Document::ObjectWrapper Generator::generateDocument(const std::shared_ptr<oatpp::swagger::DocumentInfo>& docInfo,
+                                                    const std::shared_ptr<Endpoints>& endpoints,
+                                                    v_int32 workers)
+{
+  Generator generator;
+  return generator.generate(docInfo, endpoints, workers);
+}
+
+OAuthFlow::ObjectWrapper Generator::generateOAuthFlow(const std::shared_ptr<oatpp::swagger::OAuthFlow>& flow) {
+
+  if(!flow) {
+    return nullptr;
+  }
+
+  auto oasFlow = OAuthFlow::createShared();
+  oasFlow->tokenUrl = flow->tokenUrl;
+  oasFlow->refreshUrl = flow->refreshUrl;
+  oasFlow->authorizationUrl = flow->authorizationUrl;
+
+  if(flow->scopes) {
+    oasFlow->scopes = oasFlow->scopes->createShared();
+    // scopes are kept in a hash map - order them by name
+    for(const auto& name : getSortedKeys(*flow->scopes)) {
+      oasFlow->scopes->put(name, flow->scopes->at(name));
+    }
+  }
+
+  return oasFlow;
+
+}
+
 SecurityScheme::ObjectWrapper Generator::generateSecurityScheme(const std::shared_ptr<oatpp::swagger::SecurityScheme> &ss) {
   auto oasSS = oatpp::swagger::oas3::SecurityScheme::createShared();
 
@@ -485,54 +1496,10 @@ SecurityScheme::ObjectWrapper Generator::generateSecurityScheme(const std::share
 
   if(ss->flows) {
     oasSS->flows = oasSS->flows->createShared();
-    if(ss->flows->implicit) {
-      oasSS->flows->implicit = oasSS->flows->implicit->createShared();
-      oasSS->flows->implicit->tokenUrl = ss->flows->implicit->tokenUrl;
-      oasSS->flows->implicit->refreshUrl = ss->flows->implicit->refreshUrl;
-      oasSS->flows->implicit->authorizationUrl = ss->flows->implicit->authorizationUrl;
-      if(ss->flows->implicit->scopes) {
-        oasSS->flows->implicit->scopes->createShared();
-        for(const auto &scope : *ss->flows->implicit->scopes) {
-          oasSS->flows->implicit->scopes->put(scope.first, scope.second);
-        }
-      }
-    }
-    if(ss->flows->password) {
-      oasSS->flows->password = oasSS->flows->password->createShared();
-      oasSS->flows->password->tokenUrl = ss->flows->password->tokenUrl;
-      oasSS->flows->password->refreshUrl = ss->flows->password->refreshUrl;
-      oasSS->flows->password->authorizationUrl = ss->flows->password->authorizationUrl;
-      if(ss->flows->password->scopes) {
-        oasSS->flows->password->scopes->createShared();
-        for(const auto &scope : *ss->flows->password->scopes) {
-          oasSS->flows->password->scopes->put(scope.first, scope.second);
-        }
-      }
-    }
-    if(ss->flows->clientCredentials) {
-      oasSS->flows->clientCredentials = oasSS->flows->clientCredentials->createShared();
-      oasSS->flows->clientCredentials->tokenUrl = ss->flows->clientCredentials->tokenUrl;
-      oasSS->flows->clientCredentials->refreshUrl = ss->flows->clientCredentials->refreshUrl;
-      oasSS->flows->clientCredentials->authorizationUrl = ss->flows->clientCredentials->authorizationUrl;
-      if(ss->flows->clientCredentials->scopes) {
-        oasSS->flows->clientCredentials->scopes->createShared();
-        for(const auto &scope : *ss->flows->clientCredentials->scopes) {
-          oasSS->flows->clientCredentials->scopes->put(scope.first, scope.second);
-        }
-      }
-    }
-    if(ss->flows->authorizationCode) {
-      oasSS->flows->authorizationCode = oasSS->flows->authorizationCode->createShared();
-      oasSS->flows->authorizationCode->tokenUrl = ss->flows->authorizationCode->tokenUrl;
-      oasSS->flows->authorizationCode->refreshUrl = ss->flows->authorizationCode->refreshUrl;
-      oasSS->flows->authorizationCode->authorizationUrl = ss->flows->authorizationCode->authorizationUrl;
-      if(ss->flows->authorizationCode->scopes) {
-        oasSS->flows->authorizationCode->scopes->createShared();
-        for(const auto &scope : *ss->flows->authorizationCode->scopes) {
-          oasSS->flows->authorizationCode->scopes->put(scope.first, scope.second);
-        }
-      }
-    }
+    oasSS->flows->implicit = generateOAuthFlow(ss->flows->implicit);
+    oasSS->flows->password = generateOAuthFlow(ss->flows->password);
+    oasSS->flows->clientCredentials = generateOAuthFlow(ss->flows->clientCredentials);
+    oasSS->flows->authorizationCode = generateOAuthFlow(ss->flows->authorizationCode);
   }
   return oasSS;
 }
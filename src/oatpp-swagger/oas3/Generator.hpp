@@ -26,16 +26,25 @@
 #define oatpp_swagger_oas3_Generator_hpp
 
 #include "oatpp-swagger/oas3/Model.hpp"
+#include "oatpp-swagger/oas3/TypeSet.hpp"
+#include "oatpp-swagger/oas3/Arena.hpp"
 
 #include "oatpp/web/server/api/Endpoint.hpp"
 #include "oatpp/core/collection/LinkedList.hpp"
 
+#include <functional>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace oatpp { namespace swagger { namespace oas3 {
 
 /**
- * Generator of Open Api Specification 3.0.0.
+ * Generator of Open Api Specification 3.0.0. <br>
+ * Generator instance caches schemas generated for each &id:oatpp::data::mapping::type::Type; and reuses them
+ * in subsequent generations, so that regenerating documents only costs types which were not seen before. <br>
+ * Generated schemas are shared between documents and must not be modified.
+ * Generator instance may be used from multiple threads.
  */
 class Generator {
 public:
@@ -57,52 +66,358 @@ public:
   
   typedef Fields<PathItem::ObjectWrapper> Paths;
   
-  typedef std::unordered_map<oatpp::String, const oatpp::data::mapping::type::Type*> UsedTypes;
+  /**
+   * Types of objects whose schemas are put to `components/schemas`. Iterated in the order of insertion.
+   */
+  typedef TypeSet UsedTypes;
 
   typedef std::unordered_map<oatpp::String, bool> UsedSecuritySchemes;
 
+  /**
+   * Function building &id:oatpp::swagger::oas3::Schema; for a type. <br>
+   * Nested types should be resolved with &l:Generator::generateSchemaForType ();.
+   * Types which should be put to `components/schemas` are added to `usedTypes`.
+   */
+  typedef std::function<Schema::ObjectWrapper(Generator& generator,
+                                              const oatpp::data::mapping::type::Type* type,
+                                              bool linkSchema,
+                                              UsedTypes& usedTypes)> SchemaMapper;
+
+  /**
+   * Order of paths and `components/schemas` in the generated document. <br>
+   * Entries without registration order - responses, security requirements, security schemes, server variables
+   * and OAuth scopes - are always sorted, so output is byte-stable for the same inputs in both modes.
+   */
+  enum Order : v_int32 {
+
+    /**
+     * Paths in the order of endpoints, schemas in the order their types are found. Default.
+     */
+    ORDER_REGISTRATION = 0,
+
+    /**
+     * Paths and schemas sorted by name.
+     */
+    ORDER_SORTED = 1
+
+  };
+
+  /**
+   * Statistics of the type decomposition - walk through all types reachable from the types used by endpoints.
+   */
+  struct DecompositionStats {
+
+    /**
+     * Number of distinct types visited, including lists, maps and primitives.
+     */
+    v_int32 typesCount = 0;
+
+    /**
+     * Number of object types found. Schemas of these types are put to `components/schemas`.
+     */
+    v_int32 objectsCount = 0;
+
+    /**
+     * Max nesting depth of types. Types used directly by endpoints have depth `0`.
+     */
+    v_int32 maxDepth = 0;
+
+  };
+
 private:
-  static void addParamsToParametersList(const PathItemParameters::ObjectWrapper& paramsList,
-                                        Endpoint::Info::Params& params,
-                                        const oatpp::String& inType,
-                                        UsedTypes& usedTypes);
+
+  /*
+   * Cached schema together with the types it adds to UsedTypes - in the order they would be added.
+   */
+  struct CachedSchema {
+    Schema::ObjectWrapper schema;
+    std::vector<TypeSet::TypePtr> usedTypes;
+  };
+
+  typedef std::unordered_map<const oatpp::data::mapping::type::Type*, CachedSchema> SchemaCache;
+
+  /*
+   * Strings put to each operation. Shared by all generated documents instead of being allocated per endpoint.
+   */
+  struct Strings {
+    oatpp::String inHeader = "header";
+    oatpp::String inPath = "path";
+    oatpp::String inQuery = "query";
+    oatpp::String requestBody = "request body";
+    oatpp::String success = "success";
+    oatpp::String applicationJson = "application/json";
+    oatpp::String textPlain = "text/plain";
+  };
+
+  /*
+   * Installs arena pool of the current generation. Uninstalls it when generation ends, also by exception.
+   */
+  class ArenaScope {
+  private:
+    Generator* m_generator;
+  public:
+    ArenaScope(Generator* generator, ArenaPool* arenaPool);
+    ~ArenaScope();
+  };
+
+private:
+  std::unordered_map<const char*, SchemaMapper> m_schemaMappers;
+  std::mutex m_cacheLock;
+  SchemaCache m_linkedSchemas;
+  SchemaCache m_schemas;
+  std::unordered_map<v_int32, oatpp::String> m_statusCodes;
+  DecompositionStats m_decompositionStats;
+  Strings m_strings;
+private:
+  Order m_order;
+  bool m_useArena;
+  bool m_deduplicate;
+  std::mutex m_generateLock;
+  ArenaPool* m_arenaPool;
 private:
+  const std::shared_ptr<Arena>* getThreadArena();
+  oatpp::String getStatusCode(v_int32 code);
 
-  static Schema::ObjectWrapper generateSchemaForTypeList(const oatpp::data::mapping::type::Type* type, bool linkSchema, UsedTypes& usedTypes);
-  static Schema::ObjectWrapper generateSchemaForTypeObject(const oatpp::data::mapping::type::Type* type, bool linkSchema, UsedTypes& usedTypes);
-  static Schema::ObjectWrapper generateSchemaForType(const oatpp::data::mapping::type::Type* type, bool linkSchema, UsedTypes& usedTypes);
+  /*
+   * Create list or map of the field type. Ex.: `body->content = createFor(body->content);`
+   */
+  template<class Wrapper>
+  Wrapper createFor(const Wrapper&) {
+    return create<typename Wrapper::ObjectType>();
+  }
 
-  static RequestBody::ObjectWrapper generateRequestBody(const Endpoint::Info& endpointInfo, bool linkSchema, UsedTypes& usedTypes);
-  static Fields<OperationResponse::ObjectWrapper>::ObjectWrapper generateResponses(const Endpoint::Info& endpointInfo, bool linkSchema, UsedTypes& usedTypes);
-  static void generatePathItemData(const std::shared_ptr<Endpoint>& endpoint, const PathItem::ObjectWrapper& pathItem, UsedTypes& usedTypes, UsedSecuritySchemes &usedSecuritySchemes);
+private:
+  static void addUsedTypes(const std::vector<TypeSet::TypePtr>& types, UsedTypes& usedTypes);
+private:
+  void addParamsToParametersList(const PathItemParameters::ObjectWrapper& paramsList,
+                                 Endpoint::Info::Params& params,
+                                 const oatpp::String& inType,
+                                 UsedTypes& usedTypes);
+private:
+
+  Schema::ObjectWrapper generateSchemaForTypeList(const oatpp::data::mapping::type::Type* type, bool linkSchema, UsedTypes& usedTypes);
+  Schema::ObjectWrapper generateSchemaForTypeMap(const oatpp::data::mapping::type::Type* type, bool linkSchema, UsedTypes& usedTypes);
+  Schema::ObjectWrapper generateSchemaForTypeObject(const oatpp::data::mapping::type::Type* type, bool linkSchema, UsedTypes& usedTypes);
+  Schema::ObjectWrapper createSchemaForType(const oatpp::data::mapping::type::Type* type, bool linkSchema, UsedTypes& usedTypes);
+  static SchemaMapper createPrimitiveMapper(const char* type, const char* format);
+
+  RequestBody::ObjectWrapper generateRequestBody(const Endpoint::Info& endpointInfo, bool linkSchema, UsedTypes& usedTypes);
+  Fields<OperationResponse::ObjectWrapper>::ObjectWrapper generateResponses(const Endpoint::Info& endpointInfo, bool linkSchema, UsedTypes& usedTypes);
+  void generatePathItemData(const std::shared_ptr<Endpoint>& endpoint, const PathItem::ObjectWrapper& pathItem, UsedTypes& usedTypes, UsedSecuritySchemes &usedSecuritySchemes);
   
   /*
    *  UsedTypes& usedTypes is used to put Types of objects whos schema should be reused
    */
-  static Paths::ObjectWrapper generatePaths(const std::shared_ptr<Endpoints>& endpoints, UsedTypes& usedTypes, UsedSecuritySchemes &usedSecuritySchemes);
+  Paths::ObjectWrapper generatePaths(const std::shared_ptr<Endpoints>& endpoints, UsedTypes& usedTypes, UsedSecuritySchemes &usedSecuritySchemes);
+
+  /*
+   *  Parallel generation. Used types and security schemes are recorded per endpoint,
+   *  merged sets are then rebuilt in the order serial generation would have produced them.
+   */
+  static void runWorkers(v_int32 workers, v_int32 count, const std::function<void(v_int32 worker, v_int32 index)>& task);
+  static oatpp::String getEndpointPath(const std::shared_ptr<Endpoint>& endpoint);
+  static void collectSecuritySchemes(const PathItemOperation::ObjectWrapper& operation, UsedSecuritySchemes& usedSecuritySchemes);
+  PathItem::ObjectWrapper copyPathItem(const PathItem::ObjectWrapper& pathItem);
+  static void mergePathItem(const PathItem::ObjectWrapper& from, const PathItem::ObjectWrapper& to, UsedSecuritySchemes& usedSecuritySchemes);
+  Paths::ObjectWrapper generatePathsParallel(const std::shared_ptr<Endpoints>& endpoints,
+                                             v_int32 workers,
+                                             UsedTypes& usedTypes,
+                                             UsedSecuritySchemes &usedSecuritySchemes);
 
+  static OAuthFlow::ObjectWrapper generateOAuthFlow(const std::shared_ptr<oatpp::swagger::OAuthFlow>& flow);
   static SecurityScheme::ObjectWrapper generateSecurityScheme(const std::shared_ptr<oatpp::swagger::SecurityScheme> &ss);
 
-  static void decomposeObject(const oatpp::data::mapping::type::Type* type, UsedTypes& decomposedTypes);
-  static void decomposeList(const oatpp::data::mapping::type::Type* type, UsedTypes& decomposedTypes);
-  static void decomposeMap(const oatpp::data::mapping::type::Type* type, UsedTypes& decomposedTypes);
-  static void decomposeType(const oatpp::data::mapping::type::Type* type, UsedTypes& decomposedTypes);
-  static UsedTypes decomposeTypes(UsedTypes& usedTypes);
+  static UsedTypes decomposeTypes(const UsedTypes& usedTypes, DecompositionStats& stats);
+  static void sortDocument(const Document::ObjectWrapper& document);
   
-  static Components::ObjectWrapper generateComponents(const UsedTypes &decomposedTypes,
-                                                      const std::shared_ptr<std::unordered_map<oatpp::String,std::shared_ptr<oatpp::swagger::SecurityScheme>>> &securitySchemes,
-                                                      UsedSecuritySchemes &usedSecuritySchemes);
+  Components::ObjectWrapper generateComponents(const UsedTypes &decomposedTypes,
+                                               const std::shared_ptr<std::unordered_map<oatpp::String,std::shared_ptr<oatpp::swagger::SecurityScheme>>> &securitySchemes,
+                                               UsedSecuritySchemes &usedSecuritySchemes,
+                                               v_int32 workers = 1);
 
 public:
 
   /**
-   * Generate Open Api Specification 3.0.0. from &l:Generator::Endpoints;.
+   * Constructor. Registers schema mappers for oatpp built-in types and &id:oatpp::swagger::Binary;.
+   */
+  Generator();
+
+  /**
+   * Create shared Generator.
+   * @return - `std::shared_ptr` to Generator.
+   */
+  static std::shared_ptr<Generator> createShared() {
+    return std::make_shared<Generator>();
+  }
+
+  /**
+   * Generate Open Api Specification 3.0.0. from &l:Generator::Endpoints; reusing schemas cached by previous generations.
+   * @param docInfo - &id:oatpp::swagger::DocumentInfo;.
+   * @param endpoints &l:Generator::Endpoints;.
+   * @param workers - number of threads including the calling one. `1` or less - generate on the calling thread only.
+   * @return - &id:oatpp::swagger::oas3::Document;.
+   */
+  Document::ObjectWrapper generate(const std::shared_ptr<oatpp::swagger::DocumentInfo>& docInfo,
+                                   const std::shared_ptr<Endpoints>& endpoints,
+                                   v_int32 workers = 1);
+
+  /**
+   * Extend existing document with endpoints which are not in it yet (ex.: controller was added at runtime). <br>
+   * Only path items of the new endpoints and schemas which are not in the document's components yet are generated.
+   * The given document is not modified - the result shares all unchanged path items and schemas with it. <br>
+   * New paths and schemas are appended after the existing ones, so the order may differ from the one of full generation.
+   * @param docInfo - &id:oatpp::swagger::DocumentInfo;. Used to resolve new security schemes.
+   * @param document - existing &id:oatpp::swagger::oas3::Document;.
+   * @param endpoints - new &l:Generator::Endpoints;.
+   * @param workers - number of threads including the calling one. `1` or less - generate on the calling thread only.
+   * @return - new &id:oatpp::swagger::oas3::Document;.
+   */
+  Document::ObjectWrapper extend(const std::shared_ptr<oatpp::swagger::DocumentInfo>& docInfo,
+                                 const Document::ObjectWrapper& document,
+                                 const std::shared_ptr<Endpoints>& endpoints,
+                                 v_int32 workers = 1);
+
+  /**
+   * Register schema mapper for the type class. Replaces existing mapper if any. <br>
+   * Types are dispatched by identity of their class name pointer (&id:oatpp::data::mapping::type::Type::name;).
+   * Types without a mapper get schema of `type` = class name and `format` = name qualifier. <br>
+   * Should not be called while document is being generated. Drops schemas cache.
+   * @param classId - `CLASS_NAME` of the type class. Ex.: `oatpp::swagger::__class::Binary::CLASS_NAME`.
+   * @param mapper - &l:Generator::SchemaMapper;.
+   */
+  void registerSchemaMapper(const char* classId, const SchemaMapper& mapper);
+
+  /**
+   * Create generator with the same schema mappers and settings (arena allocation, deduplication, order) and an empty schema cache. <br>
+   * Use it to change settings without affecting the generator shared with others.
+   * Should not be called while schema mappers are being registered.
+   * @return - `std::shared_ptr` to Generator.
+   */
+  std::shared_ptr<Generator> createCopy() const;
+
+  /**
+   * Get schema for the type. Schemas are cached per type.
+   * @param type - &id:oatpp::data::mapping::type::Type;.
+   * @param linkSchema - `true` to get `$ref` to `components/schemas` for object types instead of full schema.
+   * @param usedTypes - &l:Generator::UsedTypes; to put types of referenced objects to.
+   * @return - &id:oatpp::swagger::oas3::Schema;.
+   */
+  Schema::ObjectWrapper generateSchemaForType(const oatpp::data::mapping::type::Type* type, bool linkSchema, UsedTypes& usedTypes);
+
+  /**
+   * Get number of cached schemas.
+   * @return - number of cached schemas.
+   */
+  v_int64 getCacheSize();
+
+  /**
+   * Get statistics of the type decomposition of the last generated (or extended) document.
+   * @return - &l:Generator::DecompositionStats;.
+   */
+  DecompositionStats getDecompositionStats();
+
+  /**
+   * Drop all cached schemas. <br>
+   * Should be called if types known to generator are unloaded (ex.: plugin library was unloaded).
+   */
+  void clearCache();
+
+  /**
+   * Compute fingerprint of the document inputs. <br>
+   * Fingerprint covers &id:oatpp::swagger::DocumentInfo;, endpoint infos and the structure of all types referenced by endpoints,
+   * so that it changes whenever the generated document would change. It is stable between process restarts. <br>
+   * Custom schema mappers are not covered - they are assumed to be the same for the same build.
+   * @param docInfo - &id:oatpp::swagger::DocumentInfo;.
+   * @param endpoints - &l:Generator::Endpoints;.
+   * @return - 16 hex digits.
+   */
+  static oatpp::String computeFingerprint(const std::shared_ptr<oatpp::swagger::DocumentInfo>& docInfo,
+                                          const std::shared_ptr<Endpoints>& endpoints);
+
+  /**
+   * Enable/disable arena allocation of the generated document. <br>
+   * When enabled, each call to &l:Generator::generate (); allocates document objects and their lists and maps from
+   * its own &id:oatpp::swagger::oas3::ArenaPool; - each generating thread takes memory from its own arena without locking.
+   * Arenas are released at once when the last object of the document is destroyed. <br>
+   * Cached schemas outlive documents, so they are never allocated from arenas.
+   * Entries of lists and maps are allocated by oatpp pools and strings are shared with endpoint infos and between documents. <br>
+   * Calls to &l:Generator::generate (); are serialized while arena allocation is enabled. <br>
+   * Should not be called while document is being generated.
+   * @param useArena - `true` to allocate document objects from arena.
+   */
+  void setUseArena(bool useArena);
+
+  /**
+   * Check if arena allocation is enabled. See &l:Generator::setUseArena ();.
+   * @return - `true` if document objects are allocated from arena.
+   */
+  bool isUseArena() const;
+
+  /**
+   * Enable/disable deduplication of the generated document (see &id:oatpp::swagger::oas3::Deduplicator;). <br>
+   * When enabled, repeated inline schemas and responses of documents returned by &l:Generator::generate (); and
+   * &l:Generator::extend (); are hoisted into `components` and referenced by `$ref`. <br>
+   * Should not be called while document is being generated.
+   * @param deduplicate - `true` to deduplicate the generated document.
+   */
+  void setDeduplicate(bool deduplicate);
+
+  /**
+   * Check if generated documents are deduplicated. See &l:Generator::setDeduplicate ();.
+   * @return - `true` if generated documents are deduplicated.
+   */
+  bool isDeduplicate() const;
+
+  /**
+   * Set order of paths and `components/schemas` in the generated document.
+   * Should not be called while document is being generated.
+   * @param order - &l:Generator::Order;.
+   */
+  void setOrder(Order order);
+
+  /**
+   * Get order of paths and `components/schemas` in the generated document. See &l:Generator::setOrder ();.
+   * @return - &l:Generator::Order;.
+   */
+  Order getOrder() const;
+
+  /**
+   * Create document object. Object is allocated from the arena of the current generation if arena allocation is enabled
+   * and the object is not a part of a (cached) schema.
+   * Should be used by &l:Generator::SchemaMapper; to create schemas.
+   * @tparam T - DTO, list or map type. Ex.: &id:oatpp::swagger::oas3::Schema;.
+   * @return - `T::ObjectWrapper`.
+   */
+  template<class T>
+  typename T::ObjectWrapper create() {
+    auto arena = getThreadArena();
+    if(arena) {
+      return typename T::ObjectWrapper(std::allocate_shared<T>(ArenaAllocator<T>(*arena)));
+    }
+    return T::createShared();
+  }
+
+
+  /**
+   * Generate Open Api Specification 3.0.0. from &l:Generator::Endpoints; with a temporary Generator instance.
    * @param docInfo - &id:oatpp::swagger::DocumentInfo;.
    * @param endpoints &l:Generator::Endpoints;.
    * @return - &id:oatpp::swagger::oas3::Document;.
    */
   static Document::ObjectWrapper generateDocument(const std::shared_ptr<oatpp::swagger::DocumentInfo>& docInfo, const std::shared_ptr<Endpoints>& endpoints);
 
+  /**
+   * Generate Open Api Specification 3.0.0. from &l:Generator::Endpoints; with a temporary Generator instance using multiple threads. <br>
+   * Path items and component schemas are generated concurrently. Result is identical to the one of the serial generation.
+   * @param docInfo - &id:oatpp::swagger::DocumentInfo;.
+   * @param endpoints &l:Generator::Endpoints;.
+   * @param workers - number of threads including the calling one. `1` or less - generate on the calling thread only.
+   * @return - &id:oatpp::swagger::oas3::Document;.
+   */
+  static Document::ObjectWrapper generateDocument(const std::shared_ptr<oatpp::swagger::DocumentInfo>& docInfo,
+                                                  const std::shared_ptr<Endpoints>& endpoints,
+                                                  v_int32 workers);
+
 };
   
 }}}
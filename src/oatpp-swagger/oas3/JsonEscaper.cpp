@@ -0,0 +1,265 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "JsonEscaper.hpp"
+
+#include "oatpp/parser/json/Utils.hpp"
+
+#if !defined(OATPP_SWAGGER_DISABLE_SIMD) && (defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__)))
+
+  #define OATPP_SWAGGER_SIMD_X86
+
+  #include <immintrin.h>
+
+  #if defined(_MSC_VER)
+    #include <intrin.h>
+    #define OATPP_SWAGGER_TARGET_AVX2
+  #else
+    // AVX2 code is compiled for this function only. It is called only if CPU supports AVX2.
+    #define OATPP_SWAGGER_TARGET_AVX2 __attribute__((target("avx2")))
+  #endif
+
+#endif
+
+namespace oatpp { namespace swagger { namespace oas3 {
+
+namespace {
+
+  typedef v_buff_size (*FindFunction)(const char* data, v_buff_size size);
+
+  /*
+   * Escape sequences of characters escaped with two characters.
+   */
+  const char* getShortEscape(v_char8 c) {
+    switch(c) {
+      case '"': return "\\\"";
+      case '\\': return "\\\\";
+      case '/': return "\\/";
+      case '\b': return "\\b";
+      case '\f': return "\\f";
+      case '\n': return "\\n";
+      case '\r': return "\\r";
+      case '\t': return "\\t";
+      default: return nullptr;
+    }
+  }
+
+  /*
+   * Size of the UTF-8 sequence by its first byte. Same rules as the ones used by escapeString.
+   */
+  v_buff_size getUtf8SequenceSize(v_char8 c) {
+    if((c & 0xE0) == 0xC0) return 2;
+    if((c & 0xF0) == 0xE0) return 3;
+    if((c & 0xF8) == 0xF0) return 4;
+    if((c & 0xFC) == 0xF8) return 5;
+    if((c & 0xFE) == 0xFC) return 6;
+    return 1; // invalid byte is a character by itself
+  }
+
+  bool isSpecial(v_char8 c) {
+    return c < 0x20 || c >= 0x80 || c == '"' || c == '\\' || c == '/';
+  }
+
+  v_buff_size findSpecialScalar(const char* data, v_buff_size size) {
+    for(v_buff_size i = 0; i < size; i ++) {
+      if(isSpecial((v_char8) data[i])) {
+        return i;
+      }
+    }
+    return size;
+  }
+
+#ifdef OATPP_SWAGGER_SIMD_X86
+
+  v_buff_size countTrailingZeros(v_uint32 mask) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (v_buff_size) index;
+#else
+    return (v_buff_size) __builtin_ctz(mask);
+#endif
+  }
+
+  v_buff_size findSpecialSse2(const char* data, v_buff_size size) {
+
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i solidus = _mm_set1_epi8('/');
+    const __m128i space = _mm_set1_epi8(0x20);
+
+    v_buff_size i = 0;
+    for(; i + 16 <= size; i += 16) {
+      __m128i chunk = _mm_loadu_si128((const __m128i*) (data + i));
+      // signed compare - bytes >= 0x80 are negative, so they are less than space as well
+      __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)),
+                                     _mm_or_si128(_mm_cmpeq_epi8(chunk, solidus), _mm_cmplt_epi8(chunk, space)));
+      v_uint32 mask = (v_uint32) _mm_movemask_epi8(special);
+      if(mask != 0) {
+        return i + countTrailingZeros(mask);
+      }
+    }
+
+    return i + findSpecialScalar(data + i, size - i);
+
+  }
+
+  OATPP_SWAGGER_TARGET_AVX2
+  v_buff_size findSpecialAvx2(const char* data, v_buff_size size) {
+
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    const __m256i solidus = _mm256_set1_epi8('/');
+    const __m256i space = _mm256_set1_epi8(0x20);
+
+    v_buff_size i = 0;
+    for(; i + 32 <= size; i += 32) {
+      __m256i chunk = _mm256_loadu_si256((const __m256i*) (data + i));
+      __m256i special = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote), _mm256_cmpeq_epi8(chunk, backslash)),
+                                        _mm256_or_si256(_mm256_cmpeq_epi8(chunk, solidus), _mm256_cmpgt_epi8(space, chunk)));
+      v_uint32 mask = (v_uint32) _mm256_movemask_epi8(special);
+      if(mask != 0) {
+        return i + countTrailingZeros(mask);
+      }
+    }
+
+    return i + findSpecialSse2(data + i, size - i);
+
+  }
+
+  bool isAvx2Supported() {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if(info[0] < 7) {
+      return false;
+    }
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    // OS should save YMM registers on context switch
+    if(!osxsave || !avx || (_xgetbv(0) & 6) != 6) {
+      return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+  }
+
+#endif
+
+  FindFunction getFindFunction(JsonEscaper::Kernel kernel) {
+    switch(kernel) {
+#ifdef OATPP_SWAGGER_SIMD_X86
+      case JsonEscaper::KERNEL_SSE2: return &findSpecialSse2;
+      case JsonEscaper::KERNEL_AVX2: return &findSpecialAvx2;
+#endif
+      default: return &findSpecialScalar;
+    }
+  }
+
+  void escapeWith(FindFunction find, std::string& out, const char* data, v_buff_size size) {
+
+    v_buff_size i = 0;
+    while(i < size) {
+
+      v_buff_size clean = find(data + i, size - i);
+      out.append(data + i, clean);
+      i += clean;
+
+      if(i == size) {
+        break;
+      }
+
+      const char* shortEscape = getShortEscape((v_char8) data[i]);
+      if(shortEscape != nullptr) {
+        out.append(shortEscape, 2);
+        i ++;
+        continue;
+      }
+
+      // Other control characters and multibyte characters are rare - escape the whole run of them with oatpp.
+      // Run ends on a character boundary, so it is escaped the same way as within the whole string.
+      v_buff_size end = i;
+      while(end < size) {
+        auto c = (v_char8) data[end];
+        if(c >= 0x80) {
+          end += getUtf8SequenceSize(c);
+        } else if(c < 0x20 && getShortEscape(c) == nullptr) {
+          end ++;
+        } else {
+          break;
+        }
+      }
+      if(end > size) {
+        end = size;
+      }
+
+      auto escaped = oatpp::parser::json::Utils::escapeString((p_char8) (data + i), end - i, false);
+      out.append((const char*) escaped->getData(), escaped->getSize());
+      i = end;
+
+    }
+
+  }
+
+}
+
+bool JsonEscaper::isSupported(Kernel kernel) {
+  switch(kernel) {
+    case KERNEL_SCALAR:
+      return true;
+#ifdef OATPP_SWAGGER_SIMD_X86
+    case KERNEL_SSE2:
+      return true;
+    case KERNEL_AVX2: {
+      static const bool avx2 = isAvx2Supported();
+      return avx2;
+    }
+#endif
+    default:
+      return false;
+  }
+}
+
+JsonEscaper::Kernel JsonEscaper::getKernel() {
+  static const Kernel kernel = isSupported(KERNEL_AVX2) ? KERNEL_AVX2 : (isSupported(KERNEL_SSE2) ? KERNEL_SSE2 : KERNEL_SCALAR);
+  return kernel;
+}
+
+void JsonEscaper::escape(std::string& out, const char* data, v_buff_size size) {
+  static const FindFunction find = getFindFunction(getKernel());
+  escapeWith(find, out, data, size);
+}
+
+void JsonEscaper::escape(std::string& out, const char* data, v_buff_size size, Kernel kernel) {
+  OATPP_ASSERT(isSupported(kernel) && "[oatpp::swagger::oas3::JsonEscaper::escape()]: Error. Kernel is not supported.");
+  escapeWith(getFindFunction(kernel), out, data, size);
+}
+
+}}}
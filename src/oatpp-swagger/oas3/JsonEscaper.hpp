@@ -0,0 +1,102 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_swagger_oas3_JsonEscaper_hpp
+#define oatpp_swagger_oas3_JsonEscaper_hpp
+
+#include "oatpp/core/Types.hpp"
+
+#include <string>
+
+namespace oatpp { namespace swagger { namespace oas3 {
+
+/**
+ * Escapes strings for JSON output of &id:oatpp::swagger::oas3::JsonWriter;. <br>
+ * Runs of characters which need no escaping are found 16 (SSE2) or 32 (AVX2) bytes at a time and copied as-is.
+ * Kernel is chosen at runtime depending on the CPU. Result is identical to `oatpp::parser::json::Utils::escapeString`.
+ */
+class JsonEscaper {
+public:
+
+  /**
+   * Kernel used to find characters which need escaping.
+   */
+  enum Kernel : v_int32 {
+
+    /**
+     * Byte by byte. Available on all platforms.
+     */
+    KERNEL_SCALAR = 0,
+
+    /**
+     * 16 bytes at a time. Available on x86 processors with SSE2.
+     */
+    KERNEL_SSE2 = 1,
+
+    /**
+     * 32 bytes at a time. Available on x86 processors with AVX2.
+     */
+    KERNEL_AVX2 = 2
+
+  };
+
+public:
+
+  /**
+   * Check if kernel can be used on this CPU. <br>
+   * Only &l:JsonEscaper::KERNEL_SCALAR; is available if module was built with `OATPP_SWAGGER_SIMD` option off.
+   * @param kernel - &l:JsonEscaper::Kernel;.
+   * @return - `true` if kernel is available.
+   */
+  static bool isSupported(Kernel kernel);
+
+  /**
+   * Get the fastest kernel available on this CPU. Kernel is detected once.
+   * @return - &l:JsonEscaper::Kernel;.
+   */
+  static Kernel getKernel();
+
+  /**
+   * Append escaped string to `out` using the fastest available kernel. Quotes are not appended.
+   * @param out - output buffer.
+   * @param data - string data.
+   * @param size - string size.
+   */
+  static void escape(std::string& out, const char* data, v_buff_size size);
+
+  /**
+   * Append escaped string to `out` using the given kernel. Quotes are not appended.
+   * @param out - output buffer.
+   * @param data - string data.
+   * @param size - string size.
+   * @param kernel - &l:JsonEscaper::Kernel;. Should be supported - see &l:JsonEscaper::isSupported ();.
+   */
+  static void escape(std::string& out, const char* data, v_buff_size size, Kernel kernel);
+
+};
+
+}}}
+
+#endif /* oatpp_swagger_oas3_JsonEscaper_hpp */
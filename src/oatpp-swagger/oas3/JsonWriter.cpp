@@ -0,0 +1,312 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "JsonWriter.hpp"
+
+#include "JsonEscaper.hpp"
+
+namespace oatpp { namespace swagger { namespace oas3 {
+
+namespace {
+
+  /*
+   * Separator before the next field or item of the object or list which is being written.
+   */
+  void writeSeparator(std::string& out) {
+    char last = out.back();
+    if(last != '{' && last != '[') {
+      out += ',';
+    }
+  }
+
+}
+
+template<std::size_t KeySize, class Wrapper>
+void JsonWriter::writeField(std::string& out, const char (&key)[KeySize], const Wrapper& value) {
+  if(value) {
+    writeSeparator(out);
+    out.append(key, KeySize - 1);
+    writeValue(out, value);
+  }
+}
+
+// null items and values are skipped the same way as null fields - consistent with includeNullFields == false
+
+template<class Wrapper>
+void JsonWriter::writeList(std::string& out, const Wrapper& list) {
+  out += '[';
+  auto curr = list->getFirstNode();
+  while(curr != nullptr) {
+    if(curr->getData()) {
+      writeSeparator(out);
+      writeValue(out, curr->getData());
+    }
+    curr = curr->getNext();
+  }
+  out += ']';
+}
+
+template<class Wrapper>
+void JsonWriter::writeMap(std::string& out, const Wrapper& map) {
+  out += '{';
+  auto curr = map->getFirstEntry();
+  while(curr != nullptr) {
+    if(curr->getValue()) {
+      writeSeparator(out);
+      writeValue(out, curr->getKey());
+      out += ':';
+      writeValue(out, curr->getValue());
+    }
+    curr = curr->getNext();
+  }
+  out += '}';
+}
+
+void JsonWriter::writeValue(std::string& out, const String& value) {
+  out += '"';
+  JsonEscaper::escape(out, (const char*) value->getData(), value->getSize());
+  out += '"';
+}
+
+void JsonWriter::writeValue(std::string& out, const Boolean& value) {
+  out += value->getValue() ? "true" : "false";
+}
+
+void JsonWriter::writeValue(std::string& out, const List<String>::ObjectWrapper& value) {
+  writeList(out, value);
+}
+
+void JsonWriter::writeValue(std::string& out, const List<Server::ObjectWrapper>::ObjectWrapper& value) {
+  writeList(out, value);
+}
+
+void JsonWriter::writeValue(std::string& out, const List<PathItemParameter::ObjectWrapper>::ObjectWrapper& value) {
+  writeList(out, value);
+}
+
+void JsonWriter::writeValue(std::string& out, const List<Fields<List<String>::ObjectWrapper>::ObjectWrapper>::ObjectWrapper& value) {
+  writeList(out, value);
+}
+
+void JsonWriter::writeValue(std::string& out, const Fields<String>::ObjectWrapper& value) {
+  writeMap(out, value);
+}
+
+void JsonWriter::writeValue(std::string& out, const Fields<List<String>::ObjectWrapper>::ObjectWrapper& value) {
+  writeMap(out, value);
+}
+
+void JsonWriter::writeValue(std::string& out, const Fields<ServerVariable::ObjectWrapper>::ObjectWrapper& value) {
+  writeMap(out, value);
+}
+
+void JsonWriter::writeValue(std::string& out, const Fields<Schema::ObjectWrapper>::ObjectWrapper& value) {
+  writeMap(out, value);
+}
+
+void JsonWriter::writeValue(std::string& out, const Fields<MediaTypeObject::ObjectWrapper>::ObjectWrapper& value) {
+  writeMap(out, value);
+}
+
+void JsonWriter::writeValue(std::string& out, const Fields<OperationResponse::ObjectWrapper>::ObjectWrapper& value) {
+  writeMap(out, value);
+}
+
+void JsonWriter::writeValue(std::string& out, const Fields<PathItem::ObjectWrapper>::ObjectWrapper& value) {
+  writeMap(out, value);
+}
+
+void JsonWriter::writeValue(std::string& out, const Fields<SecurityScheme::ObjectWrapper>::ObjectWrapper& value) {
+  writeMap(out, value);
+}
+
+void JsonWriter::writeValue(std::string& out, const Contact::ObjectWrapper& value) {
+  out += '{';
+  writeField(out, "\"name\":", value->name);
+  writeField(out, "\"url\":", value->url);
+  writeField(out, "\"email\":", value->email);
+  out += '}';
+}
+
+void JsonWriter::writeValue(std::string& out, const License::ObjectWrapper& value) {
+  out += '{';
+  writeField(out, "\"name\":", value->name);
+  writeField(out, "\"url\":", value->url);
+  out += '}';
+}
+
+void JsonWriter::writeValue(std::string& out, const Info::ObjectWrapper& value) {
+  out += '{';
+  writeField(out, "\"title\":", value->title);
+  writeField(out, "\"description\":", value->description);
+  writeField(out, "\"termsOfService\":", value->termsOfService);
+  writeField(out, "\"contact\":", value->contact);
+  writeField(out, "\"license\":", value->license);
+  writeField(out, "\"version\":", value->version);
+  out += '}';
+}
+
+void JsonWriter::writeValue(std::string& out, const ServerVariable::ObjectWrapper& value) {
+  out += '{';
+  writeField(out, "\"description\":", value->description);
+  writeField(out, "\"enum\":", value->enumValues);
+  writeField(out, "\"default\":", value->defaultValue);
+  out += '}';
+}
+
+void JsonWriter::writeValue(std::string& out, const Server::ObjectWrapper& value) {
+  out += '{';
+  writeField(out, "\"url\":", value->url);
+  writeField(out, "\"description\":", value->description);
+  writeField(out, "\"variables\":", value->variables);
+  out += '}';
+}
+
+void JsonWriter::writeValue(std::string& out, const Schema::ObjectWrapper& value) {
+  out += '{';
+  writeField(out, "\"type\":", value->type);
+  writeField(out, "\"format\":", value->format);
+  writeField(out, "\"properties\":", value->properties);
+  writeField(out, "\"items\":", value->items);
+  writeField(out, "\"additionalProperties\":", value->additionalProperties);
+  writeField(out, "\"$ref\":", value->ref);
+  out += '}';
+}
+
+void JsonWriter::writeValue(std::string& out, const MediaTypeObject::ObjectWrapper& value) {
+  out += '{';
+  writeField(out, "\"schema\":", value->schema);
+  out += '}';
+}
+
+void JsonWriter::writeValue(std::string& out, const OAuthFlow::ObjectWrapper& value) {
+  out += '{';
+  writeField(out, "\"authorizationUrl\":", value->authorizationUrl);
+  writeField(out, "\"tokenUrl\":", value->tokenUrl);
+  writeField(out, "\"refreshUrl\":", value->refreshUrl);
+  writeField(out, "\"scopes\":", value->scopes);
+  out += '}';
+}
+
+void JsonWriter::writeValue(std::string& out, const OAuthFlows::ObjectWrapper& value) {
+  out += '{';
+  writeField(out, "\"implicit\":", value->implicit);
+  writeField(out, "\"password\":", value->password);
+  writeField(out, "\"clientCredentials\":", value->clientCredentials);
+  writeField(out, "\"authorizationCode\":", value->authorizationCode);
+  out += '}';
+}
+
+void JsonWriter::writeValue(std::string& out, const SecurityScheme::ObjectWrapper& value) {
+  out += '{';
+  writeField(out, "\"type\":", value->type);
+  writeField(out, "\"description\":", value->description);
+  writeField(out, "\"name\":", value->name);
+  writeField(out, "\"in\":", value->in);
+  writeField(out, "\"scheme\":", value->scheme);
+  writeField(out, "\"bearerFormat\":", value->bearerFormat);
+  writeField(out, "\"flows\":", value->flows);
+  writeField(out, "\"openIdConnectUrl\":", value->openIdConnectUrl);
+  out += '}';
+}
+
+void JsonWriter::writeValue(std::string& out, const OperationResponse::ObjectWrapper& value) {
+  out += '{';
+  writeField(out, "\"description\":", value->description);
+  writeField(out, "\"content\":", value->content);
+  writeField(out, "\"$ref\":", value->ref);
+  out += '}';
+}
+
+void JsonWriter::writeValue(std::string& out, const RequestBody::ObjectWrapper& value) {
+  out += '{';
+  writeField(out, "\"description\":", value->description);
+  writeField(out, "\"content\":", value->content);
+  out += '}';
+}
+
+void JsonWriter::writeValue(std::string& out, const PathItemParameter::ObjectWrapper& value) {
+  out += '{';
+  writeField(out, "\"name\":", value->name);
+  writeField(out, "\"description\":", value->description);
+  writeField(out, "\"in\":", value->in);
+  writeField(out, "\"required\":", value->required);
+  writeField(out, "\"deprecated\":", value->deprecated);
+  writeField(out, "\"schema\":", value->schema);
+  out += '}';
+}
+
+void JsonWriter::writeValue(std::string& out, const PathItemOperation::ObjectWrapper& value) {
+  out += '{';
+  writeField(out, "\"description\":", value->description);
+  writeField(out, "\"summary\":", value->summary);
+  writeField(out, "\"operationId\":", value->operationId);
+  writeField(out, "\"requestBody\":", value->requestBody);
+  writeField(out, "\"tags\":", value->tags);
+  writeField(out, "\"responses\":", value->responses);
+  writeField(out, "\"parameters\":", value->parameters);
+  writeField(out, "\"security\":", value->security);
+  out += '}';
+}
+
+void JsonWriter::writeValue(std::string& out, const PathItem::ObjectWrapper& value) {
+  out += '{';
+  writeField(out, "\"get\":", value->operationGet);
+  writeField(out, "\"put\":", value->operationPut);
+  writeField(out, "\"post\":", value->operationPost);
+  writeField(out, "\"delete\":", value->operationDelete);
+  writeField(out, "\"options\":", value->operationOptions);
+  writeField(out, "\"head\":", value->operationHead);
+  writeField(out, "\"patch\":", value->operationPatch);
+  writeField(out, "\"trace\":", value->operationTrace);
+  out += '}';
+}
+
+void JsonWriter::writeValue(std::string& out, const Components::ObjectWrapper& value) {
+  out += '{';
+  writeField(out, "\"schemas\":", value->schemas);
+  writeField(out, "\"responses\":", value->responses);
+  writeField(out, "\"securitySchemes\":", value->securitySchemes);
+  out += '}';
+}
+
+void JsonWriter::writeValue(std::string& out, const Document::ObjectWrapper& value) {
+  out += '{';
+  writeField(out, "\"openapi\":", value->openapi);
+  writeField(out, "\"info\":", value->info);
+  writeField(out, "\"servers\":", value->servers);
+  writeField(out, "\"paths\":", value->paths);
+  writeField(out, "\"components\":", value->components);
+  out += '}';
+}
+
+oatpp::String JsonWriter::write(const Document::ObjectWrapper& document) {
+  OATPP_ASSERT(document && "[oatpp::swagger::oas3::JsonWriter::write()]: Error. Document should not be null.");
+  std::string out;
+  writeValue(out, document);
+  return oatpp::String(out.data(), (v_buff_size) out.size(), true);
+}
+
+}}}
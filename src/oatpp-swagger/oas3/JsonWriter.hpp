@@ -0,0 +1,115 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_swagger_oas3_JsonWriter_hpp
+#define oatpp_swagger_oas3_JsonWriter_hpp
+
+#include "oatpp-swagger/oas3/Model.hpp"
+
+#include <string>
+
+namespace oatpp { namespace swagger { namespace oas3 {
+
+/**
+ * Renders &id:oatpp::swagger::oas3::Document; and its parts as JSON without the object mapper. <br>
+ * Model classes are a closed set, so each class has its own overload writing its fields directly,
+ * with keys known at compile time. There are no property-list walks or type checks at runtime.
+ * Strings are escaped with &id:oatpp::swagger::oas3::JsonEscaper;. <br>
+ * Output is identical to the one of the JSON object mapper with `includeNullFields = false`
+ * (the object mapper used by &id:oatpp::swagger::Controller::createShared;).
+ */
+class JsonWriter {
+public:
+
+  template <class Value>
+  using Fields = oatpp::data::mapping::type::ListMap<String, Value>;
+
+  template <class Value>
+  using List = oatpp::data::mapping::type::List<Value>;
+
+private:
+
+  template<std::size_t KeySize, class Wrapper>
+  static void writeField(std::string& out, const char (&key)[KeySize], const Wrapper& value);
+
+  template<class Wrapper>
+  static void writeList(std::string& out, const Wrapper& list);
+
+  template<class Wrapper>
+  static void writeMap(std::string& out, const Wrapper& map);
+
+public:
+
+  /*
+   * Append JSON of the value to `out`. Value should not be `nullptr`.
+   */
+
+  static void writeValue(std::string& out, const String& value);
+  static void writeValue(std::string& out, const Boolean& value);
+
+  static void writeValue(std::string& out, const List<String>::ObjectWrapper& value);
+  static void writeValue(std::string& out, const List<Server::ObjectWrapper>::ObjectWrapper& value);
+  static void writeValue(std::string& out, const List<PathItemParameter::ObjectWrapper>::ObjectWrapper& value);
+  static void writeValue(std::string& out, const List<Fields<List<String>::ObjectWrapper>::ObjectWrapper>::ObjectWrapper& value);
+
+  static void writeValue(std::string& out, const Fields<String>::ObjectWrapper& value);
+  static void writeValue(std::string& out, const Fields<List<String>::ObjectWrapper>::ObjectWrapper& value);
+  static void writeValue(std::string& out, const Fields<ServerVariable::ObjectWrapper>::ObjectWrapper& value);
+  static void writeValue(std::string& out, const Fields<Schema::ObjectWrapper>::ObjectWrapper& value);
+  static void writeValue(std::string& out, const Fields<MediaTypeObject::ObjectWrapper>::ObjectWrapper& value);
+  static void writeValue(std::string& out, const Fields<OperationResponse::ObjectWrapper>::ObjectWrapper& value);
+  static void writeValue(std::string& out, const Fields<PathItem::ObjectWrapper>::ObjectWrapper& value);
+  static void writeValue(std::string& out, const Fields<SecurityScheme::ObjectWrapper>::ObjectWrapper& value);
+
+  static void writeValue(std::string& out, const Contact::ObjectWrapper& value);
+  static void writeValue(std::string& out, const License::ObjectWrapper& value);
+  static void writeValue(std::string& out, const Info::ObjectWrapper& value);
+  static void writeValue(std::string& out, const ServerVariable::ObjectWrapper& value);
+  static void writeValue(std::string& out, const Server::ObjectWrapper& value);
+  static void writeValue(std::string& out, const Schema::ObjectWrapper& value);
+  static void writeValue(std::string& out, const MediaTypeObject::ObjectWrapper& value);
+  static void writeValue(std::string& out, const OAuthFlow::ObjectWrapper& value);
+  static void writeValue(std::string& out, const OAuthFlows::ObjectWrapper& value);
+  static void writeValue(std::string& out, const SecurityScheme::ObjectWrapper& value);
+  static void writeValue(std::string& out, const OperationResponse::ObjectWrapper& value);
+  static void writeValue(std::string& out, const RequestBody::ObjectWrapper& value);
+  static void writeValue(std::string& out, const PathItemParameter::ObjectWrapper& value);
+  static void writeValue(std::string& out, const PathItemOperation::ObjectWrapper& value);
+  static void writeValue(std::string& out, const PathItem::ObjectWrapper& value);
+  static void writeValue(std::string& out, const Components::ObjectWrapper& value);
+  static void writeValue(std::string& out, const Document::ObjectWrapper& value);
+
+  /**
+   * Render document as JSON.
+   * @param document - &id:oatpp::swagger::oas3::Document;.
+   * @return - &id:oatpp::String; containing JSON document.
+   */
+  static oatpp::String write(const Document::ObjectWrapper& document);
+
+};
+
+}}}
+
+#endif /* oatpp_swagger_oas3_JsonWriter_hpp */
@@ -300,6 +300,11 @@ class Schema : public oatpp::data::mapping::type::Object {
    */
   DTO_FIELD(Schema::ObjectWrapper, items);
 
+  /**
+   * Schema of the map values.
+   */
+  DTO_FIELD(Schema::ObjectWrapper, additionalProperties);
+
   /**
    * Ref.
    */
@@ -443,6 +448,11 @@ class OperationResponse : public oatpp::data::mapping::type::Object {
    * &l:MediaTypeObject;.
    */
   DTO_FIELD(Fields<MediaTypeObject::ObjectWrapper>::ObjectWrapper, content);
+
+  /**
+   * Ref. Reference to the response in `components/responses`.
+   */
+  DTO_FIELD(String, ref, "$ref");
   
 };
 
@@ -615,6 +625,11 @@ class Components : public oatpp::data::mapping::type::Object {
    */
   DTO_FIELD(Fields<Schema::ObjectWrapper>::ObjectWrapper, schemas);
 
+  /**
+   * Map of &id:oatpp::String; to &l:OperationResponse;.
+   */
+  DTO_FIELD(Fields<OperationResponse::ObjectWrapper>::ObjectWrapper, responses);
+
   /**
    * Map of &id:oatpp::String; to &l:SecurityScheme;.
    */
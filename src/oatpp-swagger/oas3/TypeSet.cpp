@@ -0,0 +1,113 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "TypeSet.hpp"
+
+#include <cstdint>
+
+namespace oatpp { namespace swagger { namespace oas3 {
+
+TypeSet::TypeSet()
+  : m_index(16, -1)
+  , m_mask(15)
+{}
+
+v_uint64 TypeSet::hash(TypePtr type) {
+  // Fibonacci hashing of the address. Low bits are dropped since types are aligned.
+  v_uint64 value = (v_uint64) reinterpret_cast<std::uintptr_t>(type);
+  return (value >> 3) * 11400714819323198485ull;
+}
+
+v_uint64 TypeSet::findSlot(TypePtr type) const {
+  v_uint64 slot = (hash(type) >> 32) & m_mask;
+  while(m_index[slot] >= 0 && m_types[m_index[slot]] != type) {
+    slot = (slot + 1) & m_mask;
+  }
+  return slot;
+}
+
+void TypeSet::rehash(v_uint64 capacity) {
+  m_index.assign(capacity, -1);
+  m_mask = capacity - 1;
+  for(v_int32 i = 0; i < (v_int32) m_types.size(); i ++) {
+    m_index[findSlot(m_types[i])] = i;
+  }
+}
+
+bool TypeSet::insert(TypePtr type) {
+
+  v_uint64 slot = findSlot(type);
+  if(m_index[slot] >= 0) {
+    return false;
+  }
+
+  m_index[slot] = (v_int32) m_types.size();
+  m_types.push_back(type);
+
+  // keep load factor under 1/2
+  if(m_types.size() * 2 > m_index.size()) {
+    rehash(m_index.size() * 2);
+  }
+
+  return true;
+
+}
+
+void TypeSet::insertAll(const TypeSet& other) {
+  for(TypePtr type : other.m_types) {
+    insert(type);
+  }
+}
+
+bool TypeSet::contains(TypePtr type) const {
+  return m_index[findSlot(type)] >= 0;
+}
+
+v_int32 TypeSet::size() const {
+  return (v_int32) m_types.size();
+}
+
+bool TypeSet::empty() const {
+  return m_types.empty();
+}
+
+void TypeSet::clear() {
+  m_types.clear();
+  m_index.assign(16, -1);
+  m_mask = 15;
+}
+
+const std::vector<TypeSet::TypePtr>& TypeSet::getTypes() const {
+  return m_types;
+}
+
+TypeSet::const_iterator TypeSet::begin() const {
+  return m_types.begin();
+}
+
+TypeSet::const_iterator TypeSet::end() const {
+  return m_types.end();
+}
+
+}}}
@@ -0,0 +1,109 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_swagger_oas3_TypeSet_hpp
+#define oatpp_swagger_oas3_TypeSet_hpp
+
+#include "oatpp/core/data/mapping/type/Type.hpp"
+
+#include <vector>
+
+namespace oatpp { namespace swagger { namespace oas3 {
+
+/**
+ * Insertion-ordered set of &id:oatpp::data::mapping::type::Type; keyed by type identity. <br>
+ * Types are kept in a flat array in the order they were inserted, lookup goes through an open-addressing
+ * (linear probing) index of that array. No string hashing and no per-element allocations.
+ */
+class TypeSet {
+public:
+  typedef const oatpp::data::mapping::type::Type* TypePtr;
+  typedef std::vector<TypePtr>::const_iterator const_iterator;
+private:
+  static v_uint64 hash(TypePtr type);
+private:
+  std::vector<TypePtr> m_types;
+  std::vector<v_int32> m_index; // positions in m_types, -1 - empty slot. Size is power of two.
+  v_uint64 m_mask;
+private:
+  v_uint64 findSlot(TypePtr type) const;
+  void rehash(v_uint64 capacity);
+public:
+
+  /**
+   * Constructor.
+   */
+  TypeSet();
+
+  /**
+   * Add type to set.
+   * @param type - &id:oatpp::data::mapping::type::Type;.
+   * @return - `true` if type was added, `false` if it was already in the set.
+   */
+  bool insert(TypePtr type);
+
+  /**
+   * Add all types of other set, in order.
+   * @param other - TypeSet.
+   */
+  void insertAll(const TypeSet& other);
+
+  /**
+   * Check if type is in the set.
+   * @param type - &id:oatpp::data::mapping::type::Type;.
+   * @return - `true` if type is in the set.
+   */
+  bool contains(TypePtr type) const;
+
+  /**
+   * Number of types in the set.
+   * @return - number of types.
+   */
+  v_int32 size() const;
+
+  /**
+   * Check if set is empty.
+   * @return - `true` if set is empty.
+   */
+  bool empty() const;
+
+  /**
+   * Remove all types.
+   */
+  void clear();
+
+  /**
+   * Types in the order of insertion.
+   * @return - `std::vector` of types.
+   */
+  const std::vector<TypePtr>& getTypes() const;
+
+  const_iterator begin() const;
+  const_iterator end() const;
+
+};
+
+}}}
+
+#endif /* oatpp_swagger_oas3_TypeSet_hpp */
@@ -0,0 +1,503 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "YamlWriter.hpp"
+
+#include <string>
+
+namespace oatpp { namespace swagger { namespace oas3 {
+
+/**
+ * Block-style YAML emitter. <br>
+ * Each key starts a new line. Sequence items are written as `- ` followed by the first key of the item inline.
+ */
+class YamlWriter::Emitter {
+private:
+
+  static bool isPlainSafe(const char* data, v_buff_size size) {
+
+    if(size == 0) {
+      return false;
+    }
+
+    switch(data[0]) {
+      case '-': case '?': case ':': case ',': case '[': case ']': case '{': case '}':
+      case '#': case '&': case '*': case '!': case '|': case '>': case '\'': case '"':
+      case '%': case '@': case '`': case ' ': case '+': case '.': case '~':
+        return false;
+      default:
+        break;
+    }
+
+    // numbers must stay strings
+    if(data[0] >= '0' && data[0] <= '9') {
+      return false;
+    }
+
+    if(data[size - 1] == ' ' || data[size - 1] == ':') {
+      return false;
+    }
+
+    for(v_buff_size i = 0; i < size; i ++) {
+      auto c = (v_char8) data[i];
+      if(c < 0x20 || c == 0x7F) {
+        return false;
+      }
+      if(c == ':' && i + 1 < size && data[i + 1] == ' ') {
+        return false;
+      }
+      if(c == '#' && i > 0 && data[i - 1] == ' ') {
+        return false;
+      }
+    }
+
+    static const char* const reserved[] = {"true", "false", "null", "yes", "no", "on", "off", "y", "n"};
+    for(const char* word : reserved) {
+      v_buff_size wordSize = std::char_traits<char>::length(word);
+      if(wordSize == size && oatpp::base::StrBuffer::equalsCI(data, word, size)) {
+        return false;
+      }
+    }
+
+    return true;
+
+  }
+
+  /*
+   * Literal block scalar is used for multiline text (ex.: markdown descriptions)
+   */
+  static bool isLiteralSafe(const char* data, v_buff_size size) {
+
+    if(size == 0 || data[0] == ' ' || data[0] == '\n') {
+      return false;
+    }
+
+    bool hasLineBreak = false;
+    for(v_buff_size i = 0; i < size; i ++) {
+      auto c = (v_char8) data[i];
+      if(c == '\n') {
+        if(i + 1 < size && data[i + 1] == '\n' && i + 2 == size) {
+          return false; // more than one trailing line break
+        }
+        hasLineBreak = true;
+      } else if((c < 0x20 && c != '\t') || c == 0x7F) {
+        return false;
+      } else if(c == ' ' && (i + 1 == size || data[i + 1] == '\n')) {
+        return false; // trailing spaces are not preserved reliably by editors
+      }
+    }
+
+    return hasLineBreak;
+
+  }
+
+private:
+  std::string m_buffer;
+  v_int32 m_indent;
+  bool m_itemStart;
+private:
+
+  void writeSeparator() {
+    if(m_itemStart) {
+      m_itemStart = false;
+    } else {
+      m_buffer += ' ';
+    }
+  }
+
+  void writeDoubleQuoted(const char* data, v_buff_size size) {
+    static const char* const hex = "0123456789ABCDEF";
+    m_buffer += '"';
+    for(v_buff_size i = 0; i < size; i ++) {
+      auto c = (v_char8) data[i];
+      switch(c) {
+        case '"': m_buffer += "\\\""; break;
+        case '\\': m_buffer += "\\\\"; break;
+        case '\n': m_buffer += "\\n"; break;
+        case '\r': m_buffer += "\\r"; break;
+        case '\t': m_buffer += "\\t"; break;
+        default:
+          if(c < 0x20 || c == 0x7F) {
+            m_buffer += "\\x";
+            m_buffer += hex[c >> 4];
+            m_buffer += hex[c & 0x0F];
+          } else {
+            m_buffer += (char) c;
+          }
+      }
+    }
+    m_buffer += '"';
+  }
+
+  void writeLiteral(const char* data, v_buff_size size) {
+
+    if(data[size - 1] == '\n') {
+      m_buffer += "|";
+      size --;
+    } else {
+      m_buffer += "|-";
+    }
+
+    v_buff_size lineStart = 0;
+    for(v_buff_size i = 0; i <= size; i ++) {
+      if(i == size || data[i] == '\n') {
+        m_buffer += '\n';
+        if(i > lineStart) {
+          m_buffer.append(m_indent + 2, ' ');
+          m_buffer.append(data + lineStart, i - lineStart);
+        }
+        lineStart = i + 1;
+      }
+    }
+
+  }
+
+public:
+
+  Emitter()
+    : m_indent(0)
+    , m_itemStart(false)
+  {}
+
+  void writeKey(const char* name, v_buff_size size) {
+    if(m_itemStart) {
+      m_itemStart = false;
+    } else {
+      m_buffer += '\n';
+      m_buffer.append(m_indent, ' ');
+    }
+    if(isPlainSafe(name, size)) {
+      m_buffer.append(name, size);
+    } else {
+      writeDoubleQuoted(name, size);
+    }
+    m_buffer += ':';
+  }
+
+  void writeString(const char* data, v_buff_size size) {
+    writeSeparator();
+    if(isPlainSafe(data, size)) {
+      m_buffer.append(data, size);
+    } else if(isLiteralSafe(data, size)) {
+      writeLiteral(data, size);
+    } else {
+      writeDoubleQuoted(data, size);
+    }
+  }
+
+  void writeRaw(const char* text) {
+    writeSeparator();
+    m_buffer += text;
+  }
+
+  v_buff_size beginCollection() {
+    m_indent += 2;
+    return (v_buff_size) m_buffer.size();
+  }
+
+  void endCollection(v_buff_size marker, const char* emptyValue) {
+    m_indent -= 2;
+    if((v_buff_size) m_buffer.size() == marker) {
+      writeRaw(emptyValue);
+    }
+  }
+
+  void beginItem() {
+    m_buffer += '\n';
+    m_buffer.append(m_indent, ' ');
+    m_buffer += "- ";
+    m_itemStart = true;
+  }
+
+  oatpp::String toString() {
+    v_buff_size offset = (!m_buffer.empty() && m_buffer[0] == '\n') ? 1 : 0;
+    m_buffer += '\n';
+    return oatpp::String(m_buffer.data() + offset, (v_buff_size) m_buffer.size() - offset, true);
+  }
+
+};
+
+template<class Wrapper>
+void YamlWriter::writeField(Emitter& emitter, const char* name, const Wrapper& value) {
+  if(value) {
+    emitter.writeKey(name, std::char_traits<char>::length(name));
+    writeValue(emitter, value);
+  }
+}
+
+template<class Wrapper>
+void YamlWriter::writeList(Emitter& emitter, const Wrapper& list) {
+  auto marker = emitter.beginCollection();
+  auto curr = list->getFirstNode();
+  while(curr != nullptr) {
+    emitter.beginItem();
+    if(curr->getData()) {
+      writeValue(emitter, curr->getData());
+    } else {
+      emitter.writeRaw("null");
+    }
+    curr = curr->getNext();
+  }
+  emitter.endCollection(marker, "[]");
+}
+
+template<class Wrapper>
+void YamlWriter::writeMap(Emitter& emitter, const Wrapper& map) {
+  auto marker = emitter.beginCollection();
+  auto curr = map->getFirstEntry();
+  while(curr != nullptr) {
+    const auto& key = curr->getKey();
+    emitter.writeKey(key->c_str(), key->getSize());
+    if(curr->getValue()) {
+      writeValue(emitter, curr->getValue());
+    } else {
+      emitter.writeRaw("null");
+    }
+    curr = curr->getNext();
+  }
+  emitter.endCollection(marker, "{}");
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const String& value) {
+  emitter.writeString(value->c_str(), value->getSize());
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const Boolean& value) {
+  emitter.writeRaw(value->getValue() ? "true" : "false");
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const List<String>::ObjectWrapper& value) {
+  writeList(emitter, value);
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const List<Server::ObjectWrapper>::ObjectWrapper& value) {
+  writeList(emitter, value);
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const List<PathItemParameter::ObjectWrapper>::ObjectWrapper& value) {
+  writeList(emitter, value);
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const List<Fields<List<String>::ObjectWrapper>::ObjectWrapper>::ObjectWrapper& value) {
+  writeList(emitter, value);
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const Fields<String>::ObjectWrapper& value) {
+  writeMap(emitter, value);
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const Fields<List<String>::ObjectWrapper>::ObjectWrapper& value) {
+  writeMap(emitter, value);
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const Fields<ServerVariable::ObjectWrapper>::ObjectWrapper& value) {
+  writeMap(emitter, value);
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const Fields<Schema::ObjectWrapper>::ObjectWrapper& value) {
+  writeMap(emitter, value);
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const Fields<MediaTypeObject::ObjectWrapper>::ObjectWrapper& value) {
+  writeMap(emitter, value);
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const Fields<OperationResponse::ObjectWrapper>::ObjectWrapper& value) {
+  writeMap(emitter, value);
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const Fields<PathItem::ObjectWrapper>::ObjectWrapper& value) {
+  writeMap(emitter, value);
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const Fields<SecurityScheme::ObjectWrapper>::ObjectWrapper& value) {
+  writeMap(emitter, value);
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const Contact::ObjectWrapper& value) {
+  auto marker = emitter.beginCollection();
+  writeField(emitter, "name", value->name);
+  writeField(emitter, "url", value->url);
+  writeField(emitter, "email", value->email);
+  emitter.endCollection(marker, "{}");
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const License::ObjectWrapper& value) {
+  auto marker = emitter.beginCollection();
+  writeField(emitter, "name", value->name);
+  writeField(emitter, "url", value->url);
+  emitter.endCollection(marker, "{}");
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const Info::ObjectWrapper& value) {
+  auto marker = emitter.beginCollection();
+  writeField(emitter, "title", value->title);
+  writeField(emitter, "description", value->description);
+  writeField(emitter, "termsOfService", value->termsOfService);
+  writeField(emitter, "contact", value->contact);
+  writeField(emitter, "license", value->license);
+  writeField(emitter, "version", value->version);
+  emitter.endCollection(marker, "{}");
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const ServerVariable::ObjectWrapper& value) {
+  auto marker = emitter.beginCollection();
+  writeField(emitter, "description", value->description);
+  writeField(emitter, "enum", value->enumValues);
+  writeField(emitter, "default", value->defaultValue);
+  emitter.endCollection(marker, "{}");
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const Server::ObjectWrapper& value) {
+  auto marker = emitter.beginCollection();
+  writeField(emitter, "url", value->url);
+  writeField(emitter, "description", value->description);
+  writeField(emitter, "variables", value->variables);
+  emitter.endCollection(marker, "{}");
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const Schema::ObjectWrapper& value) {
+  auto marker = emitter.beginCollection();
+  writeField(emitter, "type", value->type);
+  writeField(emitter, "format", value->format);
+  writeField(emitter, "properties", value->properties);
+  writeField(emitter, "items", value->items);
+  writeField(emitter, "additionalProperties", value->additionalProperties);
+  writeField(emitter, "$ref", value->ref);
+  emitter.endCollection(marker, "{}");
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const MediaTypeObject::ObjectWrapper& value) {
+  auto marker = emitter.beginCollection();
+  writeField(emitter, "schema", value->schema);
+  emitter.endCollection(marker, "{}");
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const OAuthFlow::ObjectWrapper& value) {
+  auto marker = emitter.beginCollection();
+  writeField(emitter, "authorizationUrl", value->authorizationUrl);
+  writeField(emitter, "tokenUrl", value->tokenUrl);
+  writeField(emitter, "refreshUrl", value->refreshUrl);
+  writeField(emitter, "scopes", value->scopes);
+  emitter.endCollection(marker, "{}");
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const OAuthFlows::ObjectWrapper& value) {
+  auto marker = emitter.beginCollection();
+  writeField(emitter, "implicit", value->implicit);
+  writeField(emitter, "password", value->password);
+  writeField(emitter, "clientCredentials", value->clientCredentials);
+  writeField(emitter, "authorizationCode", value->authorizationCode);
+  emitter.endCollection(marker, "{}");
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const SecurityScheme::ObjectWrapper& value) {
+  auto marker = emitter.beginCollection();
+  writeField(emitter, "type", value->type);
+  writeField(emitter, "description", value->description);
+  writeField(emitter, "name", value->name);
+  writeField(emitter, "in", value->in);
+  writeField(emitter, "scheme", value->scheme);
+  writeField(emitter, "bearerFormat", value->bearerFormat);
+  writeField(emitter, "flows", value->flows);
+  writeField(emitter, "openIdConnectUrl", value->openIdConnectUrl);
+  emitter.endCollection(marker, "{}");
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const OperationResponse::ObjectWrapper& value) {
+  auto marker = emitter.beginCollection();
+  writeField(emitter, "description", value->description);
+  writeField(emitter, "content", value->content);
+  writeField(emitter, "$ref", value->ref);
+  emitter.endCollection(marker, "{}");
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const RequestBody::ObjectWrapper& value) {
+  auto marker = emitter.beginCollection();
+  writeField(emitter, "description", value->description);
+  writeField(emitter, "content", value->content);
+  emitter.endCollection(marker, "{}");
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const PathItemParameter::ObjectWrapper& value) {
+  auto marker = emitter.beginCollection();
+  writeField(emitter, "name", value->name);
+  writeField(emitter, "description", value->description);
+  writeField(emitter, "in", value->in);
+  writeField(emitter, "required", value->required);
+  writeField(emitter, "deprecated", value->deprecated);
+  writeField(emitter, "schema", value->schema);
+  emitter.endCollection(marker, "{}");
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const PathItemOperation::ObjectWrapper& value) {
+  auto marker = emitter.beginCollection();
+  writeField(emitter, "description", value->description);
+  writeField(emitter, "summary", value->summary);
+  writeField(emitter, "operationId", value->operationId);
+  writeField(emitter, "requestBody", value->requestBody);
+  writeField(emitter, "tags", value->tags);
+  writeField(emitter, "responses", value->responses);
+  writeField(emitter, "parameters", value->parameters);
+  writeField(emitter, "security", value->security);
+  emitter.endCollection(marker, "{}");
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const PathItem::ObjectWrapper& value) {
+  auto marker = emitter.beginCollection();
+  writeField(emitter, "get", value->operationGet);
+  writeField(emitter, "put", value->operationPut);
+  writeField(emitter, "post", value->operationPost);
+  writeField(emitter, "delete", value->operationDelete);
+  writeField(emitter, "options", value->operationOptions);
+  writeField(emitter, "head", value->operationHead);
+  writeField(emitter, "patch", value->operationPatch);
+  writeField(emitter, "trace", value->operationTrace);
+  emitter.endCollection(marker, "{}");
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const Components::ObjectWrapper& value) {
+  auto marker = emitter.beginCollection();
+  writeField(emitter, "schemas", value->schemas);
+  writeField(emitter, "responses", value->responses);
+  writeField(emitter, "securitySchemes", value->securitySchemes);
+  emitter.endCollection(marker, "{}");
+}
+
+void YamlWriter::writeValue(Emitter& emitter, const Document::ObjectWrapper& value) {
+  writeField(emitter, "openapi", value->openapi);
+  writeField(emitter, "info", value->info);
+  writeField(emitter, "servers", value->servers);
+  writeField(emitter, "paths", value->paths);
+  writeField(emitter, "components", value->components);
+}
+
+oatpp::String YamlWriter::write(const Document::ObjectWrapper& document) {
+  OATPP_ASSERT(document && "[oatpp::swagger::oas3::YamlWriter::write()]: Error. Document should not be null.");
+  Emitter emitter;
+  writeValue(emitter, document);
+  return emitter.toString();
+}
+
+}}}
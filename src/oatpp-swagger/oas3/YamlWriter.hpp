@@ -0,0 +1,111 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi, <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_swagger_oas3_YamlWriter_hpp
+#define oatpp_swagger_oas3_YamlWriter_hpp
+
+#include "oatpp-swagger/oas3/Model.hpp"
+
+namespace oatpp { namespace swagger { namespace oas3 {
+
+/**
+ * Renders &id:oatpp::swagger::oas3::Document; as YAML. <br>
+ * Walks the model directly, field by field, in the same order and with the same `null`-field skipping
+ * as the JSON rendering.
+ */
+class YamlWriter {
+public:
+
+  template <class Value>
+  using Fields = oatpp::data::mapping::type::ListMap<String, Value>;
+
+  template <class Value>
+  using List = oatpp::data::mapping::type::List<Value>;
+
+private:
+
+  class Emitter;
+
+private:
+
+  template<class Wrapper>
+  static void writeField(Emitter& emitter, const char* name, const Wrapper& value);
+
+  template<class Wrapper>
+  static void writeList(Emitter& emitter, const Wrapper& list);
+
+  template<class Wrapper>
+  static void writeMap(Emitter& emitter, const Wrapper& map);
+
+private:
+
+  static void writeValue(Emitter& emitter, const String& value);
+  static void writeValue(Emitter& emitter, const Boolean& value);
+
+  static void writeValue(Emitter& emitter, const List<String>::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const List<Server::ObjectWrapper>::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const List<PathItemParameter::ObjectWrapper>::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const List<Fields<List<String>::ObjectWrapper>::ObjectWrapper>::ObjectWrapper& value);
+
+  static void writeValue(Emitter& emitter, const Fields<String>::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const Fields<List<String>::ObjectWrapper>::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const Fields<ServerVariable::ObjectWrapper>::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const Fields<Schema::ObjectWrapper>::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const Fields<MediaTypeObject::ObjectWrapper>::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const Fields<OperationResponse::ObjectWrapper>::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const Fields<PathItem::ObjectWrapper>::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const Fields<SecurityScheme::ObjectWrapper>::ObjectWrapper& value);
+
+  static void writeValue(Emitter& emitter, const Contact::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const License::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const Info::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const ServerVariable::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const Server::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const Schema::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const MediaTypeObject::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const OAuthFlow::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const OAuthFlows::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const SecurityScheme::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const OperationResponse::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const RequestBody::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const PathItemParameter::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const PathItemOperation::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const PathItem::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const Components::ObjectWrapper& value);
+  static void writeValue(Emitter& emitter, const Document::ObjectWrapper& value);
+
+public:
+
+  /**
+   * Render document as YAML.
+   * @param document - &id:oatpp::swagger::oas3::Document;.
+   * @return - &id:oatpp::String; containing YAML document.
+   */
+  static oatpp::String write(const Document::ObjectWrapper& document);
+
+};
+
+}}}
+
+#endif /* oatpp_swagger_oas3_YamlWriter_hpp */
@@ -7,14 +7,110 @@
 #include "test-controllers/TestAsyncController.hpp"
 
 #include "oatpp-swagger/AsyncController.hpp"
+#include "oatpp-swagger/DocumentGroups.hpp"
+#include "oatpp/web/server/HttpRouter.hpp"
+#include "oatpp/web/protocol/http/incoming/Request.hpp"
 #include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+#include "oatpp/core/data/stream/BufferStream.hpp"
+#include "oatpp/core/async/Executor.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <cstring>
 #include <iostream>
+#include <thread>
 
 namespace oatpp { namespace test { namespace swagger {
 
 namespace {
 
+  typedef oatpp::web::server::HttpRouter HttpRouter;
+  typedef oatpp::web::protocol::http::incoming::Request IncomingRequest;
+  typedef oatpp::web::protocol::http::outgoing::Response OutgoingResponse;
+  typedef oatpp::web::protocol::http::Headers Headers;
+
+  /*
+   * Response of the endpoint coroutine, or message of the error it finished with.
+   */
+  struct AsyncResult {
+    std::shared_ptr<OutgoingResponse> response;
+    oatpp::String error;
+  };
+
+  /*
+   * Route request the same way HttpProcessor does and run the endpoint coroutine.
+   */
+  class RequestCoroutine : public oatpp::async::Coroutine<RequestCoroutine> {
+  private:
+    std::shared_ptr<HttpRouter> m_router;
+    oatpp::String m_path;
+    Headers m_headers;
+    AsyncResult* m_result;
+  public:
+
+    RequestCoroutine(const std::shared_ptr<HttpRouter>& router, const oatpp::String& path, const Headers& headers, AsyncResult* result)
+      : m_router(router)
+      , m_path(path)
+      , m_headers(headers)
+      , m_result(result)
+    {}
+
+    Action act() override {
+      auto route = m_router->getRoute("GET", m_path);
+      OATPP_ASSERT(route);
+      oatpp::web::protocol::http::RequestStartingLine startingLine;
+      startingLine.method = "GET";
+      startingLine.path = m_path;
+      startingLine.protocol = "HTTP/1.1";
+      auto request = IncomingRequest::createShared(startingLine, route.matchMap, m_headers, nullptr, nullptr);
+      return route.processEventAsync(request).callbackTo(&RequestCoroutine::onResponse);
+    }
+
+    Action onResponse(const std::shared_ptr<OutgoingResponse>& response) {
+      m_result->response = response;
+      return finish();
+    }
+
+    Action handleError(const std::shared_ptr<const Error>& error) override {
+      m_result->error = error->what();
+      return finish();
+    }
+
+  };
+
+  AsyncResult executeRequest(oatpp::async::Executor& executor,
+                             const std::shared_ptr<HttpRouter>& router,
+                             const oatpp::String& path,
+                             const Headers& headers = Headers())
+  {
+    AsyncResult result;
+    executor.execute<RequestCoroutine>(router, path, headers, &result);
+    executor.waitTasksFinished();
+    return result;
+  }
+
+  oatpp::String responseToString(const std::shared_ptr<OutgoingResponse>& response) {
+    oatpp::data::stream::ChunkedBuffer stream;
+    stream.setOutputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
+    oatpp::data::stream::BufferOutputStream responseBuffer;
+    response->send(&stream, &responseBuffer, nullptr);
+    return stream.toString();
+  }
+
+  /*
+   * Parse document from the body of serialized response.
+   */
+  oatpp::swagger::oas3::Document::ObjectWrapper readDocument(const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper,
+                                                            const std::shared_ptr<OutgoingResponse>& response)
+  {
+    auto text = responseToString(response);
+    oatpp::parser::Caret caret(text);
+    caret.findChar('{');
+    auto document = objectMapper->readFromCaret<oatpp::swagger::oas3::Document>(caret);
+    OATPP_ASSERT(caret.hasError() == false);
+    return document;
+  }
+
   class SwaggerComponent {
   public:
 
@@ -70,8 +166,182 @@ void AsyncControllerTest::onRun() {
 
   auto swaggerController = oatpp::swagger::AsyncController::createShared(docEndpoints);
 
-  // TODO test generated document here
-  OATPP_LOGV(TAG, "TODO implement test");
+  auto router = HttpRouter::createShared();
+  swaggerController->addEndpointsToRouter(router);
+
+  oatpp::async::Executor executor(1, 1, 1);
+
+  { // OAS-Doc
+
+    auto result = executeRequest(executor, router, "/api-docs/oas-3.0.0.json");
+    OATPP_ASSERT(result.response && result.response->getStatus().code == 200);
+
+    auto document = readDocument(objectMapper, result.response);
+    OATPP_ASSERT(document->paths->count() == swaggerController->getDocumentCache()->getDocument()->paths->count());
+
+  }
+
+  { // YAML - fixed path is matched before /api-docs/{filename}
+
+    auto result = executeRequest(executor, router, "/api-docs/oas-3.0.0.yaml");
+    OATPP_ASSERT(result.response && result.response->getStatus().code == 200);
+
+    auto text = responseToString(result.response);
+    auto body = swaggerController->getDocumentCache()->getYaml()->getBody();
+    OATPP_ASSERT(std::strstr(text->c_str(), "application/yaml") != nullptr);
+    OATPP_ASSERT(std::strstr(text->c_str(), body->c_str()) != nullptr);
+
+  }
+
+  { // Lite
+
+    auto result = executeRequest(executor, router, "/api-docs/oas-3.0.0-lite.json");
+    OATPP_ASSERT(result.response && result.response->getStatus().code == 200);
+
+    auto document = readDocument(objectMapper, result.response);
+    OATPP_ASSERT(document->paths->count() == swaggerController->getDocumentCache()->getDocument()->paths->count());
+
+  }
+
+  { // Groups are not configured - other files under /api-docs/ are rejected
+
+    auto result = executeRequest(executor, router, "/api-docs/public.json");
+    OATPP_ASSERT(!result.response);
+    OATPP_ASSERT(result.error && std::strstr(result.error->c_str(), "Document groups are not configured") != nullptr);
+
+  }
+
+  { // Named document groups
+
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::DocumentInfo>, documentInfo);
+
+    auto publicEndpoints = oatpp::swagger::AsyncController::Endpoints::createShared();
+    publicEndpoints->pushBack(docEndpoints->getFirstNode()->getData());
+
+    auto groups = oatpp::swagger::DocumentGroups::createShared();
+    groups->addGroup("public", documentInfo, publicEndpoints)
+           .addGroup("internal", documentInfo, docEndpoints);
+
+    auto groupsController = oatpp::swagger::AsyncController::createShared(groups);
+    auto groupsRouter = HttpRouter::createShared();
+    groupsController->addEndpointsToRouter(groupsRouter);
+
+    auto result = executeRequest(executor, groupsRouter, "/api-docs/public.json");
+    OATPP_ASSERT(result.response && result.response->getStatus().code == 200);
+    OATPP_ASSERT(readDocument(objectMapper, result.response)->paths->count() == 1);
+
+    result = executeRequest(executor, groupsRouter, "/api-docs/internal.yaml");
+    OATPP_ASSERT(result.response && result.response->getStatus().code == 200);
+    OATPP_ASSERT(std::strstr(responseToString(result.response)->c_str(), "application/yaml") != nullptr);
+
+    // first group is served at the default location
+    result = executeRequest(executor, groupsRouter, "/api-docs/oas-3.0.0.json");
+    OATPP_ASSERT(result.response && result.response->getStatus().code == 200);
+    OATPP_ASSERT(readDocument(objectMapper, result.response)->paths->count() == 1);
+
+    result = executeRequest(executor, groupsRouter, "/api-docs/partner.json");
+    OATPP_ASSERT(!result.response);
+    OATPP_ASSERT(result.error && std::strstr(result.error->c_str(), "Unknown document group") != nullptr);
+
+  }
+
+  { // Tag-filtered document
+
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::Resources>, resources);
+
+    auto text = swaggerController->getDocumentCache()->getJson()->getBody();
+    auto document = objectMapper->readFromString<oatpp::swagger::oas3::Document>(text);
+
+    auto curr = document->paths->getFirstEntry();
+    while(curr != nullptr) {
+      if(curr->getKey() == "/" && curr->getValue()->operationGet) {
+        curr->getValue()->operationGet->tags = oatpp::data::mapping::type::List<oatpp::String>::createShared();
+        curr->getValue()->operationGet->tags->pushBack("root");
+      }
+      if(curr->getKey() == "/body/string" && curr->getValue()->operationPost) {
+        curr->getValue()->operationPost->tags = oatpp::data::mapping::type::List<oatpp::String>::createShared();
+        curr->getValue()->operationPost->tags->pushBack("echo");
+      }
+      curr = curr->getNext();
+    }
+
+    auto taggedController = std::make_shared<oatpp::swagger::AsyncController>(objectMapper, document, resources);
+    auto taggedRouter = HttpRouter::createShared();
+    taggedController->addEndpointsToRouter(taggedRouter);
+
+    auto result = executeRequest(executor, taggedRouter, "/api-docs/oas-3.0.0.json?tags=root");
+    OATPP_ASSERT(result.response && result.response->getStatus().code == 200);
+    auto root = readDocument(objectMapper, result.response);
+    OATPP_ASSERT(root->paths->count() == 1);
+    OATPP_ASSERT(root->paths->get("/", nullptr));
+
+    result = executeRequest(executor, taggedRouter, "/api-docs/oas-3.0.0.json?tags=echo,root");
+    OATPP_ASSERT(result.response && result.response->getStatus().code == 200);
+    OATPP_ASSERT(readDocument(objectMapper, result.response)->paths->count() == 2);
+
+    // rendered off the executor on the first request, served from the cache afterwards
+    auto cached = taggedController->getDocumentCache()->findTaggedJson("root");
+    OATPP_ASSERT(cached);
+    result = executeRequest(executor, taggedRouter, "/api-docs/oas-3.0.0.json?tags=root");
+    OATPP_ASSERT(result.response && result.response->getStatus().code == 200);
+    OATPP_ASSERT(taggedController->getDocumentCache()->findTaggedJson("root") == cached);
+
+  }
+
+  { // Deferred generation - 503 until the document is ready
+
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::DocumentInfo>, documentInfo);
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::Resources>, resources);
+
+    std::atomic<bool> hold(true);
+
+    auto config = oatpp::swagger::ControllerConfig::createShared();
+    config->deferGeneration = true;
+    config->retryAfter = 5;
+    config->generator = oatpp::swagger::oas3::Generator::createShared();
+    config->generator->registerSchemaMapper(oatpp::data::mapping::type::__class::String::CLASS_NAME,
+                                            [&hold](oatpp::swagger::oas3::Generator& generator,
+                                                    const oatpp::data::mapping::type::Type* type,
+                                                    bool linkSchema,
+                                                    oatpp::swagger::oas3::Generator::UsedTypes& usedTypes)
+    {
+      while(hold) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      auto schema = generator.create<oatpp::swagger::oas3::Schema>();
+      schema->type = "string";
+      return schema;
+    });
+
+    auto deferredController = oatpp::swagger::AsyncController::createShared(docEndpoints, documentInfo, resources, config);
+    auto deferredRouter = HttpRouter::createShared();
+    deferredController->addEndpointsToRouter(deferredRouter);
+
+    const char* paths[] = {"/api-docs/oas-3.0.0.json", "/api-docs/oas-3.0.0.yaml", "/api-docs/oas-3.0.0-lite.json"};
+    for(const char* path : paths) {
+      auto result = executeRequest(executor, deferredRouter, path);
+      OATPP_ASSERT(result.response && result.response->getStatus().code == 503);
+      OATPP_ASSERT(std::strstr(responseToString(result.response)->c_str(), "Retry-After: 5") != nullptr);
+    }
+
+    hold = false;
+
+    v_int32 attempts = 0;
+    while(!deferredController->isDocumentReady() && attempts < 1000) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      attempts ++;
+    }
+    OATPP_ASSERT(deferredController->isDocumentReady());
+
+    for(const char* path : paths) {
+      auto result = executeRequest(executor, deferredRouter, path);
+      OATPP_ASSERT(result.response && result.response->getStatus().code == 200);
+    }
+
+  }
+
+  executor.stop();
+  executor.join();
 
 }
 
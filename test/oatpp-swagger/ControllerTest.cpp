@@ -7,15 +7,121 @@
 #include "test-controllers/TestController.hpp"
 
 #include "oatpp-swagger/Controller.hpp"
+#include "oatpp-swagger/DocumentAggregator.hpp"
+#include "oatpp-swagger/DocumentGroups.hpp"
+#include "oatpp-swagger/DocumentSnapshot.hpp"
+#include "oatpp-swagger/StaticExporter.hpp"
+#include "oatpp-swagger/oas3/Deduplicator.hpp"
+#include "oatpp-swagger/oas3/DocumentFilter.hpp"
+#include "oatpp/web/server/HttpRouter.hpp"
+#include "oatpp/web/protocol/http/incoming/Request.hpp"
 #include "oatpp/parser/json/mapping/ObjectMapper.hpp"
 #include "oatpp/core/data/stream/BufferStream.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include <dirent.h>
+#include <unistd.h>
 
 namespace oatpp { namespace test { namespace swagger {
 
 namespace {
 
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+  class MemberDto : public oatpp::data::mapping::type::Object {
+
+    DTO_INIT(MemberDto, Object)
+
+    DTO_FIELD(Int32, id);
+
+  };
+
+  class TeamDto : public oatpp::data::mapping::type::Object {
+
+    DTO_INIT(TeamDto, Object)
+
+    DTO_FIELD(Fields<MemberDto::ObjectWrapper>::ObjectWrapper, members);
+
+  };
+
+#include OATPP_CODEGEN_END(DTO)
+
+  typedef oatpp::web::protocol::http::incoming::Request IncomingRequest;
+  typedef oatpp::web::protocol::http::outgoing::Response OutgoingResponse;
+  typedef oatpp::web::protocol::http::Headers Headers;
+
+  std::shared_ptr<IncomingRequest> createRequest(const oatpp::String& path,
+                                                 const Headers& headers = Headers(),
+                                                 const oatpp::web::url::mapping::Pattern::MatchMap& pathVariables = oatpp::web::url::mapping::Pattern::MatchMap())
+  {
+    oatpp::web::protocol::http::RequestStartingLine startingLine;
+    startingLine.method = "GET";
+    startingLine.path = path;
+    startingLine.protocol = "HTTP/1.1";
+    return IncomingRequest::createShared(startingLine, pathVariables, headers, nullptr, nullptr);
+  }
+
+  std::shared_ptr<OutgoingResponse> executeRequest(const std::shared_ptr<oatpp::web::server::HttpRouter>& router,
+                                                   const oatpp::String& path,
+                                                   const Headers& headers = Headers())
+  {
+    auto route = router->getRoute("GET", path);
+    OATPP_ASSERT(route);
+    return route.processEvent(createRequest(path, headers, route.matchMap));
+  }
+
+  /*
+   * Create unique empty directory for files written by the test.
+   */
+  std::string createTempDir() {
+    const char* tmp = std::getenv("TMPDIR");
+    std::string pattern = std::string(tmp ? tmp : "/tmp") + "/oatpp-swagger-test-XXXXXX";
+    std::vector<char> buffer(pattern.begin(), pattern.end());
+    buffer.push_back(0);
+    OATPP_ASSERT(mkdtemp(buffer.data()) != nullptr);
+    return std::string(buffer.data());
+  }
+
+  /*
+   * Remove directory created by createTempDir() together with the files in it.
+   */
+  void removeDir(const std::string& dir) {
+    DIR* handle = opendir(dir.c_str());
+    if(handle != nullptr) {
+      struct dirent* entry;
+      while((entry = readdir(handle)) != nullptr) {
+        std::string name = entry->d_name;
+        if(name != "." && name != "..") {
+          std::remove((dir + "/" + name).c_str());
+        }
+      }
+      closedir(handle);
+    }
+    OATPP_ASSERT(rmdir(dir.c_str()) == 0);
+  }
+
+  oatpp::String responseToString(const std::shared_ptr<OutgoingResponse>& response) {
+    oatpp::data::stream::ChunkedBuffer stream;
+    stream.setOutputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
+    oatpp::data::stream::BufferOutputStream responseBuffer;
+    response->send(&stream, &responseBuffer, nullptr);
+    return stream.toString();
+  }
+
   class SwaggerComponent {
   public:
 
@@ -78,15 +184,15 @@ void ControllerTest::onRun() {
   { // OAS-Doc
 
     // Get api json from swaggerController
-    oatpp::data::stream::ChunkedBuffer stream;
-    stream.setOutputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
+    auto responseText = responseToString(swaggerController->api(createRequest("/api-docs/oas-3.0.0.json")));
 
-    auto response = swaggerController->api();
-    response->send(&stream, &responseBuffer, nullptr);
-
-    std::cout << stream.toString()->c_str() << "\n\n";
+    std::cout << responseText->c_str() << "\n\n";
 
-    auto responseText = stream.toString();
+    // endpoint serves pre-serialized document from cache
+    auto body = swaggerController->getDocumentCache()->getJson()->getBody();
+    OATPP_ASSERT(responseText->getSize() > body->getSize());
+    OATPP_ASSERT(std::memcmp(responseText->getData() + responseText->getSize() - body->getSize(), body->getData(), body->getSize()) == 0);
+    OATPP_ASSERT(responseToString(swaggerController->api(createRequest("/api-docs/oas-3.0.0.json"))) == responseText);
 
     oatpp::parser::Caret caret(responseText);
     caret.findChar('{');
@@ -100,6 +206,837 @@ void ControllerTest::onRun() {
 
   }
 
+  { // Document is served from cache without DTO tree
+
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::DocumentInfo>, documentInfo);
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::Resources>, resources);
+
+    auto config = oatpp::swagger::ControllerConfig::createShared();
+    config->keepDocument = false;
+
+    auto cachedController = oatpp::swagger::Controller::createShared(docEndpoints, documentInfo, resources, config);
+
+    OATPP_ASSERT(!cachedController->getDocumentCache()->getDocument());
+    OATPP_ASSERT(swaggerController->getDocumentCache()->getDocument());
+    OATPP_ASSERT(cachedController->getDocumentCache()->getJson()->getBody() == swaggerController->getDocumentCache()->getJson()->getBody());
+
+  }
+
+  { // Deferred generation
+
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::DocumentInfo>, documentInfo);
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::Resources>, resources);
+
+    auto config = oatpp::swagger::ControllerConfig::createShared();
+    config->deferGeneration = true;
+    config->retryAfter = 5;
+
+    auto deferredController = oatpp::swagger::Controller::createShared(docEndpoints, documentInfo, resources, config);
+
+    auto notReady = deferredController->getDocumentPublisher()->createNotReadyResponse();
+    OATPP_ASSERT(notReady->getStatus().code == 503);
+
+    v_int32 attempts = 0;
+    while(!deferredController->isDocumentReady() && attempts < 1000) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      attempts ++;
+    }
+
+    OATPP_ASSERT(deferredController->isDocumentReady());
+    OATPP_ASSERT(deferredController->getDocumentState() == oatpp::swagger::DocumentPublisher::STATE_READY);
+    OATPP_ASSERT(deferredController->getDocumentCache()->getJson()->getBody()->getSize() ==
+                 swaggerController->getDocumentCache()->getJson()->getBody()->getSize());
+
+  }
+
+  { // Failed deferred generation
+
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::DocumentInfo>, documentInfo);
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::Resources>, resources);
+
+    std::atomic<bool> fail(true);
+
+    auto config = oatpp::swagger::ControllerConfig::createShared();
+    config->deferGeneration = true;
+    config->generator = oatpp::swagger::oas3::Generator::createShared();
+    config->generator->registerSchemaMapper(oatpp::data::mapping::type::__class::Int32::CLASS_NAME,
+                                            [&fail](oatpp::swagger::oas3::Generator& generator,
+                                                    const oatpp::data::mapping::type::Type* type,
+                                                    bool linkSchema,
+                                                    oatpp::swagger::oas3::Generator::UsedTypes& usedTypes)
+    {
+      if(fail) {
+        throw std::runtime_error("schema mapper failed");
+      }
+      auto schema = generator.create<oatpp::swagger::oas3::Schema>();
+      schema->type = "integer";
+      schema->format = "int32";
+      return schema;
+    });
+
+    auto failedController = oatpp::swagger::Controller::createShared(docEndpoints, documentInfo, resources, config);
+
+    v_int32 attempts = 0;
+    while(failedController->getDocumentState() == oatpp::swagger::DocumentPublisher::STATE_PENDING && attempts < 1000) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      attempts ++;
+    }
+
+    OATPP_ASSERT(failedController->getDocumentState() == oatpp::swagger::DocumentPublisher::STATE_FAILED);
+    OATPP_ASSERT(!failedController->isDocumentReady());
+    OATPP_ASSERT(failedController->api(createRequest("/api-docs/oas-3.0.0.json"))->getStatus().code == 500);
+
+    // failed pass leaves nothing pending - next regeneration starts from scratch
+    fail = false;
+    OATPP_ASSERT(failedController->getDocumentPublisher()->regenerate(docEndpoints));
+    OATPP_ASSERT(failedController->getDocumentState() == oatpp::swagger::DocumentPublisher::STATE_READY);
+    OATPP_ASSERT(failedController->api(createRequest("/api-docs/oas-3.0.0.json"))->getStatus().code == 200);
+
+  }
+
+  { // Parallel generation is identical to serial generation
+
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::DocumentInfo>, documentInfo);
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::Resources>, resources);
+
+    auto config = oatpp::swagger::ControllerConfig::createShared();
+    config->generatorThreads = 4;
+
+    auto parallelController = oatpp::swagger::Controller::createShared(docEndpoints, documentInfo, resources, config);
+    OATPP_ASSERT(parallelController->getDocumentCache()->getJson()->getBody() == swaggerController->getDocumentCache()->getJson()->getBody());
+
+  }
+
+  { // Generator reuses cached schemas between generations
+
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::DocumentInfo>, documentInfo);
+
+    auto generator = oatpp::swagger::oas3::Generator::createShared();
+
+    auto first = objectMapper->writeToString(generator->generate(documentInfo, docEndpoints));
+    auto cacheSize = generator->getCacheSize();
+    OATPP_ASSERT(cacheSize > 0);
+
+    auto second = objectMapper->writeToString(generator->generate(documentInfo, docEndpoints));
+    OATPP_ASSERT(generator->getCacheSize() == cacheSize);
+    OATPP_ASSERT(first == second);
+    OATPP_ASSERT(first == objectMapper->writeToString(oatpp::swagger::oas3::Generator::generateDocument(documentInfo, docEndpoints)));
+
+    generator->clearCache();
+    OATPP_ASSERT(generator->getCacheSize() == 0);
+
+  }
+
+  { // Type decomposition statistics
+
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::DocumentInfo>, documentInfo);
+
+    auto generator = oatpp::swagger::oas3::Generator::createShared();
+    auto document = generator->generate(documentInfo, docEndpoints);
+
+    auto stats = generator->getDecompositionStats();
+    OATPP_ASSERT(stats.objectsCount == document->components->schemas->count());
+    OATPP_ASSERT(stats.typesCount > stats.objectsCount);
+    OATPP_ASSERT(stats.maxDepth >= 1);
+
+  }
+
+  { // Types referenced by map values are decomposed
+
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::DocumentInfo>, documentInfo);
+
+    auto info = oatpp::web::server::api::Endpoint::Info::createShared();
+    info->name = "getTeam";
+    info->path = "/team";
+    info->method = "GET";
+    info->addResponse<TeamDto::ObjectWrapper>(oatpp::web::protocol::http::Status::CODE_200, "application/json");
+
+    auto teamEndpoints = oatpp::swagger::Controller::Endpoints::createShared();
+    teamEndpoints->pushBack(oatpp::web::server::api::Endpoint::createShared(nullptr, [info] { return info; }));
+
+    auto generator = oatpp::swagger::oas3::Generator::createShared();
+    auto document = generator->generate(documentInfo, teamEndpoints);
+
+    OATPP_ASSERT(document->components->schemas->count() == 2);
+    auto team = document->components->schemas->get("TeamDto", nullptr);
+    OATPP_ASSERT(team);
+    OATPP_ASSERT(team->properties->get("members", nullptr)->additionalProperties->ref == "#/components/schemas/MemberDto");
+    OATPP_ASSERT(document->components->schemas->get("MemberDto", nullptr));
+    OATPP_ASSERT(generator->getDecompositionStats().objectsCount == 2);
+
+  }
+
+  { // Arena-allocated document is identical to the regular one
+
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::DocumentInfo>, documentInfo);
+
+    auto generator = oatpp::swagger::oas3::Generator::createShared();
+    generator->setUseArena(true);
+
+    auto expected = objectMapper->writeToString(oatpp::swagger::oas3::Generator::generateDocument(documentInfo, docEndpoints));
+    OATPP_ASSERT(objectMapper->writeToString(generator->generate(documentInfo, docEndpoints, 4)) == expected);
+    OATPP_ASSERT(objectMapper->writeToString(generator->generate(documentInfo, docEndpoints)) == expected);
+
+    generator->clearCache();
+    OATPP_ASSERT(objectMapper->writeToString(generator->generate(documentInfo, docEndpoints)) == expected);
+
+    // arenas are released together with the document - cached schemas are not allocated from them
+    auto arenasCount = oatpp::swagger::oas3::Arena::getInstancesCount();
+    auto document = generator->generate(documentInfo, docEndpoints, 4);
+    OATPP_ASSERT(oatpp::swagger::oas3::Arena::getInstancesCount() > arenasCount);
+    OATPP_ASSERT(generator->getCacheSize() > 0);
+    document = nullptr;
+    OATPP_ASSERT(oatpp::swagger::oas3::Arena::getInstancesCount() == arenasCount);
+    generator->clearCache();
+    OATPP_ASSERT(oatpp::swagger::oas3::Arena::getInstancesCount() == arenasCount);
+
+    // arena is uninstalled when generation throws
+    bool fail = true;
+    generator->registerSchemaMapper(oatpp::data::mapping::type::__class::Int32::CLASS_NAME,
+                                    [&fail](oatpp::swagger::oas3::Generator& generator,
+                                            const oatpp::data::mapping::type::Type* type,
+                                            bool linkSchema,
+                                            oatpp::swagger::oas3::Generator::UsedTypes& usedTypes)
+    {
+      if(fail) {
+        throw std::runtime_error("schema mapper failed");
+      }
+      auto schema = generator.create<oatpp::swagger::oas3::Schema>();
+      schema->type = "integer";
+      schema->format = "int32";
+      return schema;
+    });
+
+    bool thrown = false;
+    try {
+      generator->generate(documentInfo, docEndpoints);
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+    OATPP_ASSERT(oatpp::swagger::oas3::Arena::getInstancesCount() == arenasCount);
+
+    fail = false;
+    OATPP_ASSERT(objectMapper->writeToString(generator->generate(documentInfo, docEndpoints)) == expected);
+    OATPP_ASSERT(oatpp::swagger::oas3::Arena::getInstancesCount() == arenasCount);
+
+  }
+
+  { // Deduplicated document
+
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::DocumentInfo>, documentInfo);
+
+    auto document = oatpp::swagger::oas3::Generator::generateDocument(documentInfo, docEndpoints);
+    auto expected = objectMapper->writeToString(document);
+
+    auto deduplicated = oatpp::swagger::oas3::Deduplicator::deduplicate(document);
+    auto json = objectMapper->writeToString(deduplicated);
+
+    // source document is not modified
+    OATPP_ASSERT(objectMapper->writeToString(document) == expected);
+    OATPP_ASSERT(json->getSize() < expected->getSize());
+
+    // shared "404 Not Found" response is hoisted
+    OATPP_ASSERT(deduplicated->components->responses->get("NotFound", nullptr));
+    auto deleteUser = deduplicated->paths->get("/demo/api/users/{userId}", nullptr)->operationDelete;
+    OATPP_ASSERT(deleteUser->responses->get("404", nullptr)->ref == "#/components/responses/NotFound");
+
+    // deduplication is idempotent
+    OATPP_ASSERT(objectMapper->writeToString(oatpp::swagger::oas3::Deduplicator::deduplicate(deduplicated)) == json);
+
+    auto generator = oatpp::swagger::oas3::Generator::createShared();
+    generator->setDeduplicate(true);
+    OATPP_ASSERT(objectMapper->writeToString(generator->generate(documentInfo, docEndpoints, 4)) == json);
+
+    auto parsed = objectMapper->readFromString<oatpp::swagger::oas3::Document>(json);
+    OATPP_ASSERT(objectMapper->writeToString(parsed) == json);
+
+    auto lite = objectMapper->writeToString(oatpp::swagger::oas3::DocumentFilter::createLiteDocument(deduplicated));
+    OATPP_ASSERT(std::string(lite->c_str(), lite->getSize()).find("\"$ref\":\"#/components/responses/NotFound\"") != std::string::npos);
+
+    std::unordered_set<oatpp::String> tags; // no tags - response components are dropped with the operations
+    auto tagged = oatpp::swagger::oas3::DocumentFilter::createTaggedDocument(deduplicated, tags);
+    OATPP_ASSERT(tagged->components->responses->count() == 0);
+
+  }
+
+  { // Static export
+
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::DocumentInfo>, documentInfo);
+
+    // generator shared with controllers - exporter settings must not be applied to it
+    auto sharedGenerator = oatpp::swagger::oas3::Generator::createShared();
+    auto sharedExpected = objectMapper->writeToString(sharedGenerator->generate(documentInfo, docEndpoints));
+
+    auto config = oatpp::swagger::ControllerConfig::createShared();
+    config->enableYaml = false;
+    config->enableLite = false;
+    config->enableCompression = false;
+    config->generator = sharedGenerator;
+
+    auto tempDir = createTempDir();
+    oatpp::String outDir = tempDir.c_str();
+    auto exporter = oatpp::swagger::StaticExporter::createShared(documentInfo, config);
+    exporter->exportAll(docEndpoints, OATPP_SWAGGER_RES_PATH, outDir);
+
+    auto sortedConfig = oatpp::swagger::ControllerConfig::createShared();
+    sortedConfig->enableYaml = false;
+    sortedConfig->enableLite = false;
+    sortedConfig->enableCompression = false;
+    sortedConfig->deduplicateComponents = true;
+    sortedConfig->documentOrder = oatpp::swagger::oas3::Generator::ORDER_SORTED;
+    sortedConfig->generator = sharedGenerator;
+
+    auto sortedDir = createTempDir();
+    oatpp::swagger::StaticExporter::createShared(documentInfo, sortedConfig)->exportDocument(docEndpoints, sortedDir.c_str());
+    OATPP_ASSERT(objectMapper->writeToString(sharedGenerator->generate(documentInfo, docEndpoints)) == sharedExpected);
+    removeDir(sortedDir);
+
+    std::ifstream jsonFile(std::string(outDir->c_str()) + "/" + oatpp::swagger::StaticExporter::JSON_FILE_NAME, std::ios::binary);
+    std::string json((std::istreambuf_iterator<char>(jsonFile)), std::istreambuf_iterator<char>());
+    auto expected = swaggerController->getDocumentCache()->getJson()->getBody();
+    OATPP_ASSERT(json == std::string((const char*) expected->getData(), expected->getSize()));
+
+    std::ifstream indexFile(std::string(outDir->c_str()) + "/index.html", std::ios::binary);
+    std::string index((std::istreambuf_iterator<char>(indexFile)), std::istreambuf_iterator<char>());
+    OATPP_ASSERT(index.find("url: \"oas-3.0.0.json\"") != std::string::npos);
+    OATPP_ASSERT(index.find("/api-docs/") == std::string::npos);
+
+    removeDir(tempDir);
+
+  }
+
+  { // Controller settings are not applied to the shared generator
+
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::DocumentInfo>, documentInfo);
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::Resources>, resources);
+
+    auto sharedGenerator = oatpp::swagger::oas3::Generator::createShared();
+
+    auto plainConfig = oatpp::swagger::ControllerConfig::createShared();
+    plainConfig->generator = sharedGenerator;
+    auto plainController = oatpp::swagger::Controller::createShared(docEndpoints, documentInfo, resources, plainConfig);
+    OATPP_ASSERT(plainController->getDocumentPublisher()->getGenerator() == sharedGenerator);
+
+    auto arenaConfig = oatpp::swagger::ControllerConfig::createShared();
+    arenaConfig->generator = sharedGenerator;
+    arenaConfig->arenaAllocation = true;
+    auto arenaController = oatpp::swagger::Controller::createShared(docEndpoints, documentInfo, resources, arenaConfig);
+    auto arenaGenerator = arenaController->getDocumentPublisher()->getGenerator();
+    OATPP_ASSERT(arenaGenerator != sharedGenerator);
+    OATPP_ASSERT(arenaGenerator->isUseArena());
+    OATPP_ASSERT(!sharedGenerator->isUseArena());
+    OATPP_ASSERT(arenaController->getDocumentCache()->getJson()->getBody() == swaggerController->getDocumentCache()->getJson()->getBody());
+
+    // generator which already has the settings is not copied
+    arenaConfig->generator = arenaGenerator;
+    auto reusingController = oatpp::swagger::Controller::createShared(docEndpoints, documentInfo, resources, arenaConfig);
+    OATPP_ASSERT(reusingController->getDocumentPublisher()->getGenerator() == arenaGenerator);
+
+    auto deduplicateConfig = oatpp::swagger::ControllerConfig::createShared();
+    deduplicateConfig->generator = sharedGenerator;
+    deduplicateConfig->deduplicateComponents = true;
+    auto deduplicateController = oatpp::swagger::Controller::createShared(docEndpoints, documentInfo, resources, deduplicateConfig);
+    OATPP_ASSERT(deduplicateController->getDocumentPublisher()->getGenerator()->isDeduplicate());
+    OATPP_ASSERT(!sharedGenerator->isDeduplicate());
+
+    auto sortedConfig = oatpp::swagger::ControllerConfig::createShared();
+    sortedConfig->generator = sharedGenerator;
+    sortedConfig->documentOrder = oatpp::swagger::oas3::Generator::ORDER_SORTED;
+    auto sortedController = oatpp::swagger::Controller::createShared(docEndpoints, documentInfo, resources, sortedConfig);
+    OATPP_ASSERT(sortedController->getDocumentPublisher()->getGenerator()->getOrder() == oatpp::swagger::oas3::Generator::ORDER_SORTED);
+    OATPP_ASSERT(sharedGenerator->getOrder() == oatpp::swagger::oas3::Generator::ORDER_REGISTRATION);
+
+    // snapshot fingerprint follows the settings of the generator, not only the ones of the config
+    auto deduplicatingGenerator = oatpp::swagger::oas3::Generator::createShared();
+    deduplicatingGenerator->setDeduplicate(true);
+    auto snapshotDir = createTempDir();
+    auto snapshotConfig = oatpp::swagger::ControllerConfig::createShared();
+    snapshotConfig->generator = deduplicatingGenerator;
+    snapshotConfig->snapshotDir = snapshotDir.c_str();
+    oatpp::swagger::Controller::createShared(docEndpoints, documentInfo, resources, snapshotConfig);
+    auto fingerprint = oatpp::swagger::oas3::Generator::computeFingerprint(documentInfo, docEndpoints);
+    OATPP_ASSERT(oatpp::swagger::DocumentSnapshot::load(snapshotConfig->snapshotDir, fingerprint + "-deduplicated"));
+    OATPP_ASSERT(!oatpp::swagger::DocumentSnapshot::load(snapshotConfig->snapshotDir, fingerprint));
+    removeDir(snapshotDir);
+
+  }
+
+  { // Fingerprinted document snapshot
+
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::DocumentInfo>, documentInfo);
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::Resources>, resources);
+
+    auto fingerprint = oatpp::swagger::oas3::Generator::computeFingerprint(documentInfo, docEndpoints);
+    OATPP_ASSERT(fingerprint == oatpp::swagger::oas3::Generator::computeFingerprint(documentInfo, docEndpoints));
+
+    auto otherInfo = std::make_shared<oatpp::swagger::DocumentInfo>(*documentInfo);
+    otherInfo->header = std::make_shared<oatpp::swagger::DocumentHeader>(*documentInfo->header);
+    otherInfo->header->version = "2.0";
+    OATPP_ASSERT(!(fingerprint == oatpp::swagger::oas3::Generator::computeFingerprint(otherInfo, docEndpoints)));
+
+    auto snapshotDir = createTempDir();
+    auto config = oatpp::swagger::ControllerConfig::createShared();
+    config->snapshotDir = snapshotDir.c_str();
+
+    auto expected = swaggerController->getDocumentCache()->getJson()->getBody();
+
+    // no snapshot - document is generated and snapshot is written
+    auto generatedController = oatpp::swagger::Controller::createShared(docEndpoints, documentInfo, resources, config);
+    OATPP_ASSERT(generatedController->getDocumentCache()->getJson()->getBody() == expected);
+    OATPP_ASSERT(oatpp::swagger::DocumentSnapshot::load(config->snapshotDir, fingerprint) == expected);
+
+    // fingerprint matches - document is loaded from snapshot.
+    // Seeded snapshot differs from the generated document, so a load can't be mistaken for a regeneration
+    auto seededDocument = objectMapper->readFromString<oatpp::swagger::oas3::Document>(expected);
+    seededDocument->info->title = "Loaded from snapshot";
+    auto seeded = objectMapper->writeToString(seededDocument);
+    OATPP_ASSERT(oatpp::swagger::DocumentSnapshot::store(config->snapshotDir, fingerprint, seeded));
+
+    auto loadedController = oatpp::swagger::Controller::createShared(docEndpoints, documentInfo, resources, config);
+    auto loaded = loadedController->getDocumentCache()->getJson()->getBody();
+    OATPP_ASSERT(std::strstr(loaded->c_str(), "\"Loaded from snapshot\"") != nullptr);
+    OATPP_ASSERT(oatpp::swagger::DocumentSnapshot::load(config->snapshotDir, fingerprint) == seeded);
+
+    // fingerprint doesn't match - snapshot is ignored, document is generated and snapshot is replaced
+    auto otherFingerprint = oatpp::swagger::oas3::Generator::computeFingerprint(otherInfo, docEndpoints);
+    OATPP_ASSERT(oatpp::swagger::DocumentSnapshot::store(config->snapshotDir, otherFingerprint, seeded));
+    OATPP_ASSERT(!oatpp::swagger::DocumentSnapshot::load(config->snapshotDir, fingerprint));
+
+    auto mismatchController = oatpp::swagger::Controller::createShared(docEndpoints, documentInfo, resources, config);
+    OATPP_ASSERT(mismatchController->getDocumentCache()->getJson()->getBody() == expected);
+    OATPP_ASSERT(oatpp::swagger::DocumentSnapshot::load(config->snapshotDir, fingerprint) == expected);
+    OATPP_ASSERT(!oatpp::swagger::DocumentSnapshot::load(config->snapshotDir, otherFingerprint));
+
+    removeDir(snapshotDir);
+
+  }
+
+  { // Incremental generation
+
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::DocumentInfo>, documentInfo);
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::Resources>, resources);
+
+    auto firstEndpoints = oatpp::swagger::Controller::Endpoints::createShared();
+    auto secondEndpoints = oatpp::swagger::Controller::Endpoints::createShared();
+    v_int32 index = 0;
+    auto curr = docEndpoints->getFirstNode();
+    while (curr != nullptr) {
+      (index ++ < docEndpoints->count() / 2 ? firstEndpoints : secondEndpoints)->pushBack(curr->getData());
+      curr = curr->getNext();
+    }
+
+    auto fullDocument = swaggerController->getDocumentCache()->getDocument();
+
+    auto incrementalController = oatpp::swagger::Controller::createShared(firstEndpoints, documentInfo, resources);
+    auto firstDocument = incrementalController->getDocumentCache()->getDocument();
+    auto serializer = oatpp::parser::json::mapping::ObjectMapper::createShared();
+    auto firstJson = serializer->writeToString(firstDocument);
+    OATPP_ASSERT(incrementalController->extend(secondEndpoints));
+    auto document = incrementalController->getDocumentCache()->getDocument();
+
+    // previous document is not modified
+    OATPP_ASSERT(serializer->writeToString(firstDocument) == firstJson);
+    OATPP_ASSERT(firstDocument->paths->count() <= fullDocument->paths->count());
+    OATPP_ASSERT(document->paths->count() == fullDocument->paths->count());
+    OATPP_ASSERT(document->components->schemas->count() == fullDocument->components->schemas->count());
+    auto path = fullDocument->paths->getFirstEntry();
+    while (path != nullptr) {
+      OATPP_ASSERT(document->paths->get(path->getKey(), nullptr));
+      path = path->getNext();
+    }
+    auto schema = fullDocument->components->schemas->getFirstEntry();
+    while (schema != nullptr) {
+      OATPP_ASSERT(document->components->schemas->get(schema->getKey(), nullptr));
+      schema = schema->getNext();
+    }
+
+    // fragment serialization is identical to the serialization of the whole document
+    oatpp::swagger::DocumentStream::Fragments fragments;
+    OATPP_ASSERT(oatpp::swagger::DocumentStream::serialize(serializer, firstDocument, fragments) == firstJson);
+    OATPP_ASSERT(oatpp::swagger::DocumentStream::serialize(serializer, document, fragments) == serializer->writeToString(document));
+    OATPP_ASSERT(fragments.getSize() == document->paths->count() + document->components->schemas->count());
+
+    // regeneration keeps extended endpoints
+    OATPP_ASSERT(incrementalController->regenerate(firstEndpoints));
+    auto regenerated = incrementalController->getDocumentCache()->getDocument();
+    OATPP_ASSERT(regenerated->paths->count() == fullDocument->paths->count());
+    OATPP_ASSERT(regenerated->components->schemas->count() == fullDocument->components->schemas->count());
+
+  }
+
+  { // Custom schema mapper
+
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::DocumentInfo>, documentInfo);
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::Resources>, resources);
+
+    auto generator = oatpp::swagger::oas3::Generator::createShared();
+    generator->registerSchemaMapper(oatpp::data::mapping::type::__class::Int32::CLASS_NAME,
+                                    [](oatpp::swagger::oas3::Generator& generator,
+                                       const oatpp::data::mapping::type::Type* type,
+                                       bool linkSchema,
+                                       oatpp::swagger::oas3::Generator::UsedTypes& usedTypes)
+    {
+      auto schema = oatpp::swagger::oas3::Schema::createShared();
+      schema->type = "integer";
+      schema->format = "user-id";
+      return schema;
+    });
+
+    auto config = oatpp::swagger::ControllerConfig::createShared();
+    config->generator = generator;
+
+    auto customController = oatpp::swagger::Controller::createShared(docEndpoints, documentInfo, resources, config);
+    auto text = customController->getDocumentCache()->getJson()->getBody();
+
+    OATPP_ASSERT(std::strstr(text->c_str(), "\"user-id\"") != nullptr);
+    OATPP_ASSERT(std::strstr(swaggerController->getDocumentCache()->getJson()->getBody()->c_str(), "\"user-id\"") == nullptr);
+
+  }
+
+  { // Map schema
+
+    auto generator = oatpp::swagger::oas3::Generator::createShared();
+    oatpp::swagger::oas3::Generator::UsedTypes usedTypes;
+
+    auto mapType = oatpp::data::mapping::type::ListMap<oatpp::String, UserDto::ObjectWrapper>::Class::getType();
+    auto schema = generator->generateSchemaForType(mapType, true, usedTypes);
+    OATPP_ASSERT(schema->type == "object");
+    OATPP_ASSERT(!schema->properties);
+    OATPP_ASSERT(schema->additionalProperties);
+    OATPP_ASSERT(schema->additionalProperties->ref == "#/components/schemas/UserDto");
+    OATPP_ASSERT(usedTypes.size() == 1);
+
+    auto primitiveMapType = oatpp::data::mapping::type::ListMap<oatpp::String, oatpp::Int32>::Class::getType();
+    auto primitiveSchema = generator->generateSchemaForType(primitiveMapType, true, usedTypes);
+    OATPP_ASSERT(primitiveSchema->type == "object");
+    OATPP_ASSERT(primitiveSchema->additionalProperties->type == "integer");
+    OATPP_ASSERT(primitiveSchema->additionalProperties->format == "int32");
+
+    auto json = objectMapper->writeToString(primitiveSchema);
+    OATPP_ASSERT(json == "{\"type\":\"object\",\"additionalProperties\":{\"type\":\"integer\",\"format\":\"int32\"}}");
+
+  }
+
+  { // Accept-Encoding negotiation
+
+    auto json = swaggerController->getDocumentCache()->getJson();
+
+    OATPP_ASSERT(json->negotiateEncoding(nullptr) == oatpp::swagger::Compression::ENCODING_IDENTITY);
+    OATPP_ASSERT(json->negotiateEncoding("identity") == oatpp::swagger::Compression::ENCODING_IDENTITY);
+
+    // quality values don't depend on the decimal point of the locale
+    const char* locales[] = {"C", "de_DE.UTF-8", "fr_FR.UTF-8", "ru_RU.UTF-8"};
+    for(const char* locale : locales) {
+      if(std::setlocale(LC_NUMERIC, locale) != nullptr) {
+        OATPP_ASSERT(oatpp::swagger::Compression::getQuality("gzip;q=0.5", "gzip") == 0.5);
+        OATPP_ASSERT(oatpp::swagger::Compression::getQuality("gzip;q=0.125, deflate", "gzip") == 0.125);
+        OATPP_ASSERT(oatpp::swagger::Compression::getQuality("gzip;q=1.000", "gzip") == 1.0);
+        OATPP_ASSERT(oatpp::swagger::Compression::getQuality("gzip;q=0", "gzip") == 0);
+        OATPP_ASSERT(oatpp::swagger::Compression::getQuality("gzip;q=0.", "gzip") == 0);
+        OATPP_ASSERT(oatpp::swagger::Compression::getQuality("gzip;q=abc", "gzip") == 0);
+      }
+    }
+    std::setlocale(LC_NUMERIC, "C");
+
+    if(oatpp::swagger::Compression::isAvailable()) {
+      OATPP_ASSERT(json->negotiateEncoding("gzip, deflate, br") == oatpp::swagger::Compression::ENCODING_GZIP);
+      OATPP_ASSERT(json->negotiateEncoding("gzip;q=0.5, deflate") == oatpp::swagger::Compression::ENCODING_DEFLATE);
+      OATPP_ASSERT(json->negotiateEncoding("*;q=0.1, gzip;q=0") == oatpp::swagger::Compression::ENCODING_DEFLATE);
+      OATPP_ASSERT(json->getBody("gzip")->getSize() < json->getBody()->getSize());
+    } else {
+      OATPP_ASSERT(json->negotiateEncoding("gzip, deflate") == oatpp::swagger::Compression::ENCODING_IDENTITY);
+    }
+
+  }
+
+  { // ETag validation
+
+    auto json = swaggerController->getDocumentCache()->getJson();
+    auto etag = json->getETag();
+
+    OATPP_ASSERT(etag);
+    OATPP_ASSERT(json->createResponse(nullptr, nullptr)->getStatus().code == 200);
+    OATPP_ASSERT(json->createResponse(nullptr, etag)->getStatus().code == 304);
+    OATPP_ASSERT(json->createResponse(nullptr, "\"other\", W/" + etag)->getStatus().code == 304);
+    OATPP_ASSERT(json->createResponse(nullptr, "*")->getStatus().code == 304);
+    OATPP_ASSERT(json->createResponse(nullptr, "\"other\"")->getStatus().code == 200);
+
+    // 304 is sent without body and content headers
+    auto notModified = responseToString(json->createResponse(nullptr, etag));
+    std::string notModifiedText(notModified->c_str(), notModified->getSize());
+    OATPP_ASSERT(notModifiedText.find("ETag: " + std::string(etag->c_str(), etag->getSize())) != std::string::npos);
+    OATPP_ASSERT(notModifiedText.find("Content-Type") == std::string::npos);
+    OATPP_ASSERT(notModifiedText.find("Content-Encoding") == std::string::npos);
+    OATPP_ASSERT(notModifiedText.substr(notModifiedText.size() - 4) == "\r\n\r\n");
+
+    if(json->getETag("gzip")) {
+      // ETag of the identity variant does not match the gzip variant
+      OATPP_ASSERT(json->createResponse("gzip", etag)->getStatus().code == 200);
+      OATPP_ASSERT(json->createResponse("gzip", json->getETag("gzip"))->getStatus().code == 304);
+    }
+
+  }
+
+  { // Streamed document is identical to the pre-serialized one
+
+    auto stream = swaggerController->getDocumentCache()->createJsonStream();
+    OATPP_ASSERT(stream);
+
+    std::string streamed;
+    v_char8 buffer[37];
+    oatpp::async::Action action;
+    v_io_size res;
+    while((res = stream->read(buffer, sizeof(buffer), action)) > 0) {
+      streamed.append((const char*) buffer, res);
+    }
+
+    auto json = swaggerController->getDocumentCache()->getJson()->getBody();
+    OATPP_ASSERT(streamed == std::string(json->c_str(), json->getSize()));
+
+    // in stream mode only JSON is streamed - other renderings are cached
+    auto config = oatpp::swagger::ControllerConfig::createShared();
+    config->streamDocument = true;
+    auto streamCache = oatpp::swagger::DocumentCache::createShared(objectMapper, swaggerController->getDocumentCache()->getDocument(), config);
+
+    OATPP_ASSERT(!streamCache->getJson());
+    auto yaml = streamCache->getYaml();
+    OATPP_ASSERT(yaml);
+    OATPP_ASSERT(streamCache->getYaml() == yaml);
+    OATPP_ASSERT(yaml->getBody() == swaggerController->getDocumentCache()->getYaml()->getBody());
+    auto lite = streamCache->getLiteJson();
+    OATPP_ASSERT(lite);
+    OATPP_ASSERT(streamCache->getLiteJson() == lite);
+    OATPP_ASSERT(lite->getBody() == swaggerController->getDocumentCache()->getLiteJson()->getBody());
+
+    config->enableYaml = false;
+    OATPP_ASSERT(!oatpp::swagger::DocumentCache::createShared(objectMapper, swaggerController->getDocumentCache()->getDocument(), config)->getYaml());
+
+    // streamed response is validated with ETag derived from the fingerprint of document inputs
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::DocumentInfo>, documentInfo);
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::Resources>, resources);
+
+    auto streamController = oatpp::swagger::Controller::createShared(docEndpoints, documentInfo, resources, config);
+    oatpp::String etag = "\"" + oatpp::swagger::oas3::Generator::computeFingerprint(documentInfo, docEndpoints) + "\"";
+
+    auto text = responseToString(streamController->api(createRequest("/api-docs/oas-3.0.0.json")));
+    OATPP_ASSERT(std::strstr(text->c_str(), ("ETag: " + etag)->c_str()) != nullptr);
+    OATPP_ASSERT(std::strstr(text->c_str(), "Cache-Control: no-cache") != nullptr);
+
+    auto notModified = streamController->getDocumentCache()->createJsonResponse(nullptr, etag);
+    OATPP_ASSERT(notModified->getStatus().code == 304);
+    OATPP_ASSERT(streamController->getDocumentCache()->createJsonResponse(nullptr, "\"other\"")->getStatus().code == 200);
+
+  }
+
+  { // YAML rendering
+
+    auto yaml = swaggerController->getDocumentCache()->getYaml();
+    OATPP_ASSERT(yaml);
+
+    auto text = yaml->getBody();
+    OATPP_LOGD(TAG, "yaml:\n%s", text->c_str());
+
+    OATPP_ASSERT(yaml->getContentType() == "application/yaml");
+    OATPP_ASSERT(std::strncmp(text->c_str(), "openapi: \"3.0.0\"\n", 17) == 0);
+    OATPP_ASSERT(std::strstr(text->c_str(), "\n  /demo/api/users:\n") != nullptr);
+
+  }
+
+  { // Lite rendering
+
+    auto lite = swaggerController->getDocumentCache()->getLiteJson();
+    OATPP_ASSERT(lite);
+
+    auto text = lite->getBody();
+    auto full = swaggerController->getDocumentCache()->getJson()->getBody();
+
+    OATPP_ASSERT(text->getSize() < full->getSize());
+    OATPP_ASSERT(std::strstr(text->c_str(), "\"summary\"") == nullptr);
+    OATPP_ASSERT(std::strstr(text->c_str(), "\"$ref\"") != nullptr);
+
+    auto liteDocument = objectMapper->readFromString<oatpp::swagger::oas3::Document>(text);
+    OATPP_ASSERT(liteDocument->paths->count() == swaggerController->getDocumentCache()->getDocument()->paths->count());
+
+  }
+
+  { // Tag-filtered sub-documents
+
+    auto text = swaggerController->getDocumentCache()->getJson()->getBody();
+    auto document = objectMapper->readFromString<oatpp::swagger::oas3::Document>(text);
+
+    auto curr = document->paths->getFirstEntry();
+    while(curr != nullptr) {
+      if(curr->getKey() == "/" && curr->getValue()->operationGet) {
+        curr->getValue()->operationGet->tags = oatpp::data::mapping::type::List<oatpp::String>::createShared();
+        curr->getValue()->operationGet->tags->pushBack("root");
+      }
+      if(curr->getKey() == "/demo/api/users/{userId}" && curr->getValue()->operationDelete) {
+        curr->getValue()->operationDelete->tags = oatpp::data::mapping::type::List<oatpp::String>::createShared();
+        curr->getValue()->operationDelete->tags->pushBack("admin");
+      }
+      curr = curr->getNext();
+    }
+
+    std::unordered_set<oatpp::String> adminTags = {"admin"};
+    auto admin = oatpp::swagger::oas3::DocumentFilter::createTaggedDocument(document, adminTags);
+    OATPP_ASSERT(admin->paths->count() == 1);
+    OATPP_ASSERT(admin->paths->getFirstEntry()->getValue()->operationDelete);
+    OATPP_ASSERT(!admin->paths->getFirstEntry()->getValue()->operationGet);
+    OATPP_ASSERT(admin->components->schemas->count() == 0);
+
+    std::unordered_set<oatpp::String> allTags = {"root", "admin"};
+    auto all = oatpp::swagger::oas3::DocumentFilter::createTaggedDocument(document, allTags);
+    OATPP_ASSERT(all->paths->count() == 2);
+    OATPP_ASSERT(all->components->schemas->count() == 1);
+
+    auto config = oatpp::swagger::ControllerConfig::createShared();
+    config->maxFilterTags = 2;
+    auto cache = oatpp::swagger::DocumentCache::createShared(objectMapper, document, config);
+    OATPP_ASSERT(cache->getTaggedJson("root, admin") == cache->getTaggedJson("admin,root,,admin"));
+    OATPP_ASSERT(cache->getTaggedJson("admin") != cache->getTaggedJson("root"));
+
+    // unknown tags don't create new renderings
+    OATPP_ASSERT(cache->getTaggedJson("admin, unknown") == cache->getTaggedJson("admin"));
+    OATPP_ASSERT(cache->getTaggedJson("unknown") == cache->getTaggedJson("other,another"));
+
+    config->maxFilterTags = 1;
+    OATPP_ASSERT(cache->getTaggedJson("admin,a,b,c"));
+    bool rejected = false;
+    try {
+      cache->getTaggedJson("root,admin");
+    } catch (const oatpp::web::protocol::http::HttpError& error) {
+      rejected = error.getInfo().status.code == 400;
+    }
+    OATPP_ASSERT(rejected);
+
+    // lookup never renders, async rendering fills the cache
+    config->maxFilterTags = 2;
+    auto asyncCache = oatpp::swagger::DocumentCache::createShared(objectMapper, document, config);
+    OATPP_ASSERT(!asyncCache->findTaggedJson("admin"));
+    auto rendering = asyncCache->renderTaggedJsonAsync("admin");
+    auto rendered = rendering.get();
+    OATPP_ASSERT(rendered);
+    OATPP_ASSERT(rendered->getBody() == cache->getTaggedJson("admin")->getBody());
+    OATPP_ASSERT(asyncCache->findTaggedJson(" admin ") == rendered);
+    OATPP_ASSERT(asyncCache->getTaggedJson("admin") == rendered);
+
+  }
+
+  { // Hot regeneration
+
+    auto snapshot = swaggerController->getDocumentCache();
+    auto pathsCount = snapshot->getDocument()->paths->count();
+
+    auto partialEndpoints = oatpp::swagger::Controller::Endpoints::createShared();
+    partialEndpoints->pushBack(docEndpoints->getFirstNode()->getData());
+
+    OATPP_ASSERT(swaggerController->regenerate(partialEndpoints));
+    OATPP_ASSERT(swaggerController->getDocumentCache() != snapshot);
+    OATPP_ASSERT(swaggerController->getDocumentCache()->getDocument()->paths->count() == 1);
+
+    // previous snapshot is still valid for readers holding it
+    OATPP_ASSERT(snapshot->getDocument()->paths->count() == pathsCount);
+
+    OATPP_ASSERT(swaggerController->regenerate(docEndpoints));
+    OATPP_ASSERT(swaggerController->getDocumentCache()->getDocument()->paths->count() == pathsCount);
+
+  }
+
+  { // Named document groups
+
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::DocumentInfo>, documentInfo);
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::Resources>, resources);
+
+    auto publicEndpoints = oatpp::swagger::Controller::Endpoints::createShared();
+    auto internalEndpoints = oatpp::swagger::Controller::Endpoints::createShared();
+    publicEndpoints->pushBack(docEndpoints->getFirstNode()->getData());
+    internalEndpoints->pushBackAll(docEndpoints);
+
+    auto groups = oatpp::swagger::DocumentGroups::createShared();
+    groups->addGroup("public", documentInfo, publicEndpoints)
+           .addGroup("internal", documentInfo, internalEndpoints);
+
+    auto groupsController = oatpp::swagger::Controller::createShared(groups);
+    OATPP_ASSERT(groupsController->getDocumentPublisher() == groups->getGroup("public"));
+    auto publicPaths = groups->getGroup("public")->getDocumentCache()->getDocument()->paths->count();
+    OATPP_ASSERT(publicPaths < swaggerController->getDocumentCache()->getDocument()->paths->count());
+    OATPP_ASSERT(groups->getGroup("internal")->getDocumentCache()->getJson()->getBody() == swaggerController->getDocumentCache()->getJson()->getBody());
+    OATPP_ASSERT(!groups->getGroup("partner"));
+
+    OATPP_ASSERT(oatpp::swagger::DocumentGroups::getGroupName("public.json", ".json") == "public");
+    OATPP_ASSERT(!oatpp::swagger::DocumentGroups::getGroupName("public.yaml", ".json"));
+
+    // regenerating one group doesn't touch the others
+    auto publicSnapshot = groups->getGroup("public")->getDocumentCache();
+    OATPP_ASSERT(groups->regenerate("internal", publicEndpoints));
+    OATPP_ASSERT(groups->getGroup("public")->getDocumentCache() == publicSnapshot);
+    OATPP_ASSERT(groups->getGroup("internal")->getDocumentCache()->getDocument()->paths->count() == publicPaths);
+
+    oatpp::data::stream::ChunkedBuffer stream;
+    stream.setOutputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
+    groupsController->getUIRoot()->send(&stream, &responseBuffer, nullptr);
+    auto responseText = stream.toString();
+    OATPP_ASSERT(std::strstr(responseText->c_str(), "urls: [{url: \"/api-docs/public.json\", name: \"public\"}, {url: \"/api-docs/internal.json\", name: \"internal\"}]") != nullptr);
+
+  }
+
+  { // Document aggregation
+
+    OATPP_COMPONENT(std::shared_ptr<oatpp::swagger::DocumentInfo>, documentInfo);
+
+    auto sourceDocument = swaggerController->getDocumentCache()->getDocument();
+    auto firstPath = sourceDocument->paths->getFirstEntry()->getKey();
+
+    // loopback stand-in for the document fetched from a local service
+    oatpp::String ordersJson = swaggerController->getDocumentCache()->getJson()->getBody();
+    auto usersSource = oatpp::swagger::DocumentAggregator::DocumentSource::createShared(sourceDocument);
+    auto ordersSource = oatpp::swagger::DocumentAggregator::TextSource::createShared([&ordersJson] { return ordersJson; });
+
+    auto aggregator = oatpp::swagger::DocumentAggregator::createShared(documentInfo);
+    aggregator->addSource("users", usersSource, "/users")
+               .addSource("orders", ordersSource, "/orders");
+
+    auto aggregatorController = oatpp::swagger::Controller::createShared(aggregator);
+    OATPP_ASSERT(!aggregatorController->getDocumentPublisher()->isReady());
+
+    OATPP_ASSERT(aggregator->refresh() == 2);
+    OATPP_ASSERT(aggregator->refresh() == 0);
+    OATPP_ASSERT(aggregatorController->getDocumentPublisher()->isReady());
+
+    auto combined = aggregator->getPublisher()->getDocumentCache()->getDocument();
+    OATPP_ASSERT(combined->paths->count() == 2 * sourceDocument->paths->count());
+    OATPP_ASSERT(combined->components->schemas->count() == 2 * sourceDocument->components->schemas->count());
+    OATPP_ASSERT(combined->components->securitySchemes->get("users.basic_auth", nullptr));
+    OATPP_ASSERT(combined->components->securitySchemes->get("orders.basic_auth", nullptr));
+
+    auto json = aggregator->getPublisher()->getDocumentCache()->getJson()->getBody();
+    OATPP_ASSERT(std::strstr(json->c_str(), "\"$ref\":\"#/components/schemas/users.") != nullptr);
+    OATPP_ASSERT(std::strstr(json->c_str(), "\"$ref\":\"#/components/schemas/orders.") != nullptr);
+    OATPP_ASSERT(std::strstr(json->c_str(), "\"operationId\":\"orders_") != nullptr);
+    OATPP_ASSERT(std::strstr(json->c_str(), "\"security\":[{\"users.basic_auth\"") != nullptr);
+
+    // changing one source rebuilds its part only
+    auto ordersPathItem = combined->paths->get(oatpp::String("/orders") + firstPath, nullptr);
+    OATPP_ASSERT(ordersPathItem);
+
+    auto partialEndpoints = oatpp::swagger::Controller::Endpoints::createShared();
+    partialEndpoints->pushBack(docEndpoints->getFirstNode()->getData());
+    usersSource->setDocument(oatpp::swagger::oas3::Generator::generateDocument(documentInfo, partialEndpoints));
+
+    OATPP_ASSERT(aggregator->refresh() == 1);
+    auto updated = aggregator->getPublisher()->getDocumentCache()->getDocument();
+    OATPP_ASSERT(updated->paths->count() == 1 + sourceDocument->paths->count());
+    OATPP_ASSERT(updated->paths->get(oatpp::String("/orders") + firstPath, nullptr).getPtr() == ordersPathItem.getPtr());
+    OATPP_ASSERT(aggregator->getPublisher()->getDocumentCache()->getJson()->getBody() == aggregator->getObjectMapper()->writeToString(updated));
+
+    // broken text keeps the last good document
+    ordersJson = "{\"paths\": {";
+    OATPP_ASSERT(aggregator->refresh() == 0);
+    OATPP_ASSERT(aggregator->getPublisher()->getDocumentCache()->getDocument().getPtr() == updated.getPtr());
+
+  }
+
   { // index.html test
     // Get index.html from swaggerController
     oatpp::data::stream::ChunkedBuffer stream;
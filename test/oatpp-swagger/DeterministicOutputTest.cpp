@@ -0,0 +1,178 @@
+#include "DeterministicOutputTest.hpp"
+
+#include "test-controllers/TestController.hpp"
+
+#include "oatpp-swagger/oas3/Generator.hpp"
+#include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+#include "oatpp/core/utils/ConversionUtils.hpp"
+
+#include <vector>
+
+namespace oatpp { namespace test { namespace swagger {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(ApiController)
+
+  class OrderController : public oatpp::web::server::api::ApiController {
+  public:
+
+    OrderController(const std::shared_ptr<ObjectMapper>& objectMapper)
+      : oatpp::web::server::api::ApiController(objectMapper)
+    {
+      m_defaultAuthorizationHandler = std::make_shared<MyBasicAuthorizationHandler>();
+    }
+
+    ENDPOINT_INFO(getItemsZ) {
+      info->addResponse<List<UserDto::ObjectWrapper>::ObjectWrapper>(Status::CODE_200, "application/json");
+      info->addResponse<String>(Status::CODE_500, "text/plain");
+      info->addResponse<String>(Status::CODE_404, "text/plain");
+      info->addResponse<String>(Status::CODE_401, "text/plain");
+      info->addSecurityRequirement("oauth");
+      info->addSecurityRequirement("bearer_auth");
+      info->addSecurityRequirement("basic_auth");
+    }
+    ENDPOINT("GET", "z/items", getItemsZ,
+             AUTHORIZATION(std::shared_ptr<MyAuthorizationObject>, authorization)) {
+      return createResponse(Status::CODE_200, "");
+    }
+
+    ENDPOINT_INFO(getItemsA) {
+      info->addResponse<UserDto::ObjectWrapper>(Status::CODE_201, "application/json");
+      info->addResponse<String>(Status::CODE_400, "text/plain");
+    }
+    ENDPOINT("GET", "a/items", getItemsA) {
+      return createResponse(Status::CODE_200, "");
+    }
+
+  };
+
+#include OATPP_CODEGEN_END(ApiController)
+
+  std::shared_ptr<oatpp::swagger::DocumentInfo> createDocumentInfo(const std::vector<oatpp::String>& names) {
+
+    auto server = oatpp::swagger::Server::createShared();
+    server->url = "http://{host}:{port}/{base}";
+    server->variables = std::make_shared<std::unordered_map<oatpp::String, std::shared_ptr<oatpp::swagger::ServerVariable>>>();
+
+    oatpp::swagger::DocumentInfo::OAuthFlowBuilder flowBuilder;
+    flowBuilder.setAuthorizationUrl("http://localhost:8000/authorize");
+
+    for(const auto& name : names) {
+      auto variable = oatpp::swagger::ServerVariable::createShared();
+      variable->defaultValue = name;
+      (*server->variables)[name] = variable;
+      flowBuilder.addScope(name, "scope " + name);
+    }
+
+    oatpp::swagger::DocumentInfo::SecuritySchemeBuilder oauthBuilder;
+    oauthBuilder
+      .setType("oauth2")
+      .setImplicitFlow(flowBuilder.build());
+
+    oatpp::swagger::DocumentInfo::Builder builder;
+    builder
+      .setTitle("Deterministic output")
+      .setVersion("1.0")
+      .addServer(server)
+      .addSecurityScheme("oauth", oauthBuilder.build())
+      .addSecurityScheme("bearer_auth", oatpp::swagger::DocumentInfo::SecuritySchemeBuilder::DefaultBearerAuthorizationSecurityScheme())
+      .addSecurityScheme("basic_auth", oatpp::swagger::DocumentInfo::SecuritySchemeBuilder::DefaultBasicAuthorizationSecurityScheme());
+
+    return builder.build();
+
+  }
+
+  std::vector<oatpp::String> getKeys(const oatpp::swagger::oas3::Generator::Fields<oatpp::swagger::oas3::OperationResponse::ObjectWrapper>::ObjectWrapper& fields) {
+    std::vector<oatpp::String> result;
+    auto curr = fields->getFirstEntry();
+    while(curr != nullptr) {
+      result.push_back(curr->getKey());
+      curr = curr->getNext();
+    }
+    return result;
+  }
+
+}
+
+void DeterministicOutputTest::onRun() {
+
+  auto objectMapper = oatpp::parser::json::mapping::ObjectMapper::createShared();
+
+  auto controller = std::make_shared<OrderController>(objectMapper);
+  auto endpoints = oatpp::swagger::oas3::Generator::Endpoints::createShared();
+  endpoints->pushBackAll(controller->getEndpoints());
+
+  std::vector<oatpp::String> names;
+  for(v_int32 i = 0; i < 32; i ++) {
+    names.push_back("v" + oatpp::utils::conversion::int32ToStr(i));
+  }
+  std::vector<oatpp::String> reversedNames(names.rbegin(), names.rend());
+
+  auto documentInfo = createDocumentInfo(names);
+
+  { // Identical bytes across repeated generations
+
+    auto expected = objectMapper->writeToString(oatpp::swagger::oas3::Generator::generateDocument(documentInfo, endpoints));
+
+    for(v_int32 i = 0; i < 8; i ++) {
+      auto generator = oatpp::swagger::oas3::Generator::createShared();
+      OATPP_ASSERT(objectMapper->writeToString(generator->generate(documentInfo, endpoints, 1 + i % 4)) == expected);
+    }
+
+    // same inputs put to hash maps in a different order
+    auto reversed = oatpp::swagger::oas3::Generator::generateDocument(createDocumentInfo(reversedNames), endpoints);
+    OATPP_ASSERT(objectMapper->writeToString(reversed) == expected);
+
+  }
+
+  { // Entries without registration order are sorted
+
+    auto document = oatpp::swagger::oas3::Generator::generateDocument(documentInfo, endpoints);
+
+    auto operation = document->paths->get("/z/items", nullptr)->operationGet;
+    auto codes = getKeys(operation->responses);
+    OATPP_ASSERT(codes.size() == 4);
+    OATPP_ASSERT(codes[0] == "200" && codes[1] == "401" && codes[2] == "404" && codes[3] == "500");
+
+    auto security = operation->security->getFirstNode();
+    OATPP_ASSERT(security->getData()->getFirstEntry()->getKey() == "basic_auth");
+    OATPP_ASSERT(security->getNext()->getData()->getFirstEntry()->getKey() == "bearer_auth");
+    OATPP_ASSERT(security->getNext()->getNext()->getData()->getFirstEntry()->getKey() == "oauth");
+
+    auto schemes = document->components->securitySchemes->getFirstEntry();
+    OATPP_ASSERT(schemes->getKey() == "basic_auth");
+    OATPP_ASSERT(schemes->getNext()->getKey() == "bearer_auth");
+    OATPP_ASSERT(schemes->getNext()->getNext()->getKey() == "oauth");
+
+    auto scopes = schemes->getNext()->getNext()->getValue()->flows->implicit->scopes;
+    OATPP_ASSERT(scopes->count() == (v_int32) names.size());
+    OATPP_ASSERT(scopes->getFirstEntry()->getKey() == "v0");
+    OATPP_ASSERT(scopes->getFirstEntry()->getNext()->getKey() == "v1");
+    OATPP_ASSERT(scopes->getFirstEntry()->getNext()->getNext()->getKey() == "v10");
+
+    auto variables = document->servers->getFirstNode()->getData()->variables;
+    OATPP_ASSERT(variables->getFirstEntry()->getKey() == "v0");
+
+  }
+
+  { // Registration and sorted order of paths
+
+    auto document = oatpp::swagger::oas3::Generator::generateDocument(documentInfo, endpoints);
+    OATPP_ASSERT(document->paths->getFirstEntry()->getKey() == "/z/items");
+
+    auto generator = oatpp::swagger::oas3::Generator::createShared();
+    generator->setOrder(oatpp::swagger::oas3::Generator::ORDER_SORTED);
+
+    auto sorted = generator->generate(documentInfo, endpoints);
+    OATPP_ASSERT(sorted->paths->getFirstEntry()->getKey() == "/a/items");
+
+    auto expected = objectMapper->writeToString(sorted);
+    OATPP_ASSERT(objectMapper->writeToString(generator->generate(documentInfo, endpoints, 4)) == expected);
+    OATPP_ASSERT(objectMapper->writeToString(generator->generate(createDocumentInfo(reversedNames), endpoints)) == expected);
+
+  }
+
+}
+
+}}}
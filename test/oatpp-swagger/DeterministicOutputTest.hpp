@@ -0,0 +1,18 @@
+#ifndef OATPP_SWAGGER_DETERMINISTICOUTPUTTEST_HPP
+#define OATPP_SWAGGER_DETERMINISTICOUTPUTTEST_HPP
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace swagger {
+
+class DeterministicOutputTest : public UnitTest {
+public:
+
+  DeterministicOutputTest():UnitTest("TEST[swagger::DeterministicOutputTest]"){}
+  void onRun() override;
+
+};
+
+}}}
+
+#endif //OATPP_SWAGGER_DETERMINISTICOUTPUTTEST_HPP
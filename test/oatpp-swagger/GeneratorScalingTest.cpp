@@ -0,0 +1,154 @@
+#include "GeneratorScalingTest.hpp"
+
+#include "oatpp-swagger/oas3/Generator.hpp"
+#include "oatpp/core/utils/ConversionUtils.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+#include <chrono>
+#include <unordered_set>
+
+namespace oatpp { namespace test { namespace swagger {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+  class ScalingItemDto : public oatpp::data::mapping::type::Object {
+
+    DTO_INIT(ScalingItemDto, Object)
+
+    DTO_FIELD(Int32, id);
+    DTO_FIELD(String, name);
+
+  };
+
+#include OATPP_CODEGEN_END(DTO)
+
+  typedef oatpp::web::server::api::Endpoint Endpoint;
+  typedef oatpp::web::protocol::http::Status Status;
+
+  std::shared_ptr<oatpp::swagger::DocumentInfo> createDocumentInfo() {
+    oatpp::swagger::DocumentInfo::Builder builder;
+    builder
+      .setTitle("Scaling test")
+      .setVersion("1.0");
+    return builder.build();
+  }
+
+  /*
+   * Synthetic API - every path gets a GET and a PUT operation, so half of the path lookups hit an existing path item.
+   * Generator doesn't call handlers, so endpoints are created without one.
+   */
+  std::shared_ptr<oatpp::swagger::oas3::Generator::Endpoints> createEndpoints(v_int32 pathsCount) {
+
+    auto result = oatpp::swagger::oas3::Generator::Endpoints::createShared();
+
+    for(v_int32 i = 0; i < pathsCount; i ++) {
+
+      oatpp::String path = "/scale/" + oatpp::utils::conversion::int32ToStr(i) + "/items";
+
+      auto getInfo = Endpoint::Info::createShared();
+      getInfo->name = "getItems" + oatpp::utils::conversion::int32ToStr(i);
+      getInfo->path = path;
+      getInfo->method = "GET";
+      getInfo->addResponse<ScalingItemDto::ObjectWrapper>(Status::CODE_200, "application/json");
+      result->pushBack(Endpoint::createShared(nullptr, [getInfo] { return getInfo; }));
+
+      auto putInfo = Endpoint::Info::createShared();
+      putInfo->name = "putItems" + oatpp::utils::conversion::int32ToStr(i);
+      putInfo->path = path;
+      putInfo->method = "PUT";
+      putInfo->addConsumes<ScalingItemDto::ObjectWrapper>("application/json");
+      putInfo->addResponse<String>(Status::CODE_200, "text/plain");
+      result->pushBack(Endpoint::createShared(nullptr, [putInfo] { return putInfo; }));
+
+    }
+
+    return result;
+
+  }
+
+  /*
+   * Generate document and return the best time per endpoint in microseconds.
+   */
+  double measure(const std::shared_ptr<oatpp::swagger::oas3::Generator>& generator,
+                 const std::shared_ptr<oatpp::swagger::DocumentInfo>& documentInfo,
+                 const std::shared_ptr<oatpp::swagger::oas3::Generator::Endpoints>& endpoints,
+                 v_int32 pathsCount,
+                 v_int32 runs)
+  {
+
+    double best = -1;
+
+    for(v_int32 i = 0; i < runs; i ++) {
+
+      generator->clearCache();
+
+      auto start = std::chrono::steady_clock::now();
+      auto document = generator->generate(documentInfo, endpoints);
+      auto micros = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+      OATPP_ASSERT(document->paths->count() == pathsCount);
+
+      // insertion order of paths is kept
+      auto first = document->paths->getFirstEntry();
+      OATPP_ASSERT(first->getKey() == "/scale/0/items");
+      OATPP_ASSERT(first->getValue()->operationGet && first->getValue()->operationPut);
+      OATPP_ASSERT(first->getNext()->getKey() == "/scale/1/items");
+
+      // both operations of a path end up in the same path item
+      std::unordered_set<oatpp::String> keys;
+      auto curr = first;
+      while(curr != nullptr) {
+        OATPP_ASSERT(keys.insert(curr->getKey()).second);
+        curr = curr->getNext();
+      }
+
+      double perEndpoint = (double) micros / endpoints->count();
+      if(best < 0 || perEndpoint < best) {
+        best = perEndpoint;
+      }
+
+    }
+
+    return best;
+
+  }
+
+}
+
+void GeneratorScalingTest::onRun() {
+
+  auto documentInfo = createDocumentInfo();
+
+  // timings are logged only - wall-clock ratios are too noisy on shared machines to be asserted.
+  // Build with OATPP_SWAGGER_BENCHMARK to see how generation time grows with large documents.
+#ifdef OATPP_SWAGGER_BENCHMARK
+  const v_int32 sizes[] = {100, 1000, 10000, 50000};
+#else
+  const v_int32 sizes[] = {100, 1000};
+#endif
+
+  auto generator = oatpp::swagger::oas3::Generator::createShared();
+
+  // warm up - types are initialized by the first generation
+  measure(generator, documentInfo, createEndpoints(sizes[0]), sizes[0], 1);
+
+  OATPP_LOGD(TAG, "| paths | endpoints | per endpoint, us |");
+  OATPP_LOGD(TAG, "|------:|----------:|-----------------:|");
+
+  for(v_int32 pathsCount : sizes) {
+
+    auto endpoints = createEndpoints(pathsCount);
+
+    // small documents are generated several times to filter out the noise
+    v_int32 runs = pathsCount <= 1000 ? 10 : 1;
+    double perEndpoint = measure(generator, documentInfo, endpoints, pathsCount, runs);
+
+    OATPP_LOGD(TAG, "| %d | %d | %.2f |", (int) pathsCount, (int) endpoints->count(), perEndpoint);
+
+  }
+
+}
+
+}}}
@@ -0,0 +1,18 @@
+#ifndef OATPP_SWAGGER_GENERATORSCALINGTEST_HPP
+#define OATPP_SWAGGER_GENERATORSCALINGTEST_HPP
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace swagger {
+
+class GeneratorScalingTest : public UnitTest {
+public:
+
+  GeneratorScalingTest():UnitTest("TEST[swagger::GeneratorScalingTest]"){}
+  void onRun() override;
+
+};
+
+}}}
+
+#endif //OATPP_SWAGGER_GENERATORSCALINGTEST_HPP
@@ -0,0 +1,138 @@
+#include "JsonEscaperTest.hpp"
+
+#include "oatpp-swagger/oas3/JsonEscaper.hpp"
+#include "oatpp/parser/json/Utils.hpp"
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace oatpp { namespace test { namespace swagger {
+
+namespace {
+
+  typedef oatpp::swagger::oas3::JsonEscaper JsonEscaper;
+
+  const char* const KERNEL_NAMES[] = {"scalar", "sse2", "avx2"};
+
+  std::vector<JsonEscaper::Kernel> getSupportedKernels() {
+    std::vector<JsonEscaper::Kernel> result;
+    JsonEscaper::Kernel kernels[] = {JsonEscaper::KERNEL_SCALAR, JsonEscaper::KERNEL_SSE2, JsonEscaper::KERNEL_AVX2};
+    for(auto kernel : kernels) {
+      if(JsonEscaper::isSupported(kernel)) {
+        result.push_back(kernel);
+      }
+    }
+    return result;
+  }
+
+  std::string escapeReference(const std::string& text) {
+    auto escaped = oatpp::parser::json::Utils::escapeString((p_char8) text.data(), (v_buff_size) text.size(), true);
+    return std::string((const char*) escaped->getData(), escaped->getSize());
+  }
+
+  std::string escape(const std::string& text, JsonEscaper::Kernel kernel) {
+    std::string result;
+    JsonEscaper::escape(result, text.data(), (v_buff_size) text.size(), kernel);
+    return result;
+  }
+
+  void checkKernels(const std::string& text, const std::vector<JsonEscaper::Kernel>& kernels) {
+    auto expected = escapeReference(text);
+    for(auto kernel : kernels) {
+      OATPP_ASSERT(escape(text, kernel) == expected);
+    }
+  }
+
+  /*
+   * Random text biased to characters which need escaping: quotes, control characters,
+   * valid and broken UTF-8 sequences, separated by clean runs of different length.
+   */
+  std::string createRandomText(std::mt19937& random) {
+
+    static const char* const pieces[] = {
+      "\"", "\\", "/", "\n", "\r", "\t", "\b", "\f", "\x01", "\x1F", "\x7F",
+      "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", // valid UTF-8
+      "\xC3", "\xE2\x82", "\x80", "\xFF", "\xF8\x88\x80\x80\x80" // broken and obsolete UTF-8
+    };
+
+    std::string result;
+    v_int32 count = (v_int32) (random() % 16);
+    for(v_int32 i = 0; i < count; i ++) {
+      v_int32 cleanSize = (v_int32) (random() % 80);
+      for(v_int32 j = 0; j < cleanSize; j ++) {
+        result += (char) (' ' + random() % 95);
+      }
+      if(random() % 4 == 0) {
+        result += (char) (random() % 256);
+      } else {
+        result += pieces[random() % (sizeof(pieces) / sizeof(pieces[0]))];
+      }
+    }
+    return result;
+
+  }
+
+}
+
+void JsonEscaperTest::onRun() {
+
+  auto kernels = getSupportedKernels();
+  OATPP_LOGD(TAG, "best kernel='%s'", KERNEL_NAMES[JsonEscaper::getKernel()]);
+  OATPP_ASSERT(JsonEscaper::isSupported(JsonEscaper::getKernel()));
+
+  { // Special character at every position of the SIMD block and its tail
+
+    const char* specials[] = {"\"", "\\", "/", "\n", "\x01", "\xC3\xA9", "\xC3", "\xFF"};
+    for(const char* special : specials) {
+      for(v_int32 size = 0; size <= 70; size ++) {
+        for(v_int32 position = 0; position <= size; position ++) {
+          std::string text(size, 'a');
+          text.insert(position, special);
+          checkKernels(text, kernels);
+        }
+      }
+    }
+
+    checkKernels("", kernels);
+
+  }
+
+  { // Fuzz against the scalar escaper
+
+    std::mt19937 random(20240924);
+    for(v_int32 i = 0; i < 20000; i ++) {
+      checkKernels(createRandomText(random), kernels);
+    }
+
+  }
+
+  { // Throughput on markdown text
+
+    std::string text;
+    while(text.size() < 1024 * 1024) {
+      text += "## Endpoint description\n\nReturns the list of users. Use `limit` and `offset` query parameters "
+              "to page through the list, see [paging](https://example.com/docs/paging).\n\n";
+    }
+
+    const v_int32 iterations = 20;
+    for(auto kernel : kernels) {
+      std::string result;
+      auto start = std::chrono::steady_clock::now();
+      for(v_int32 i = 0; i < iterations; i ++) {
+        result.clear();
+        JsonEscaper::escape(result, text.data(), (v_buff_size) text.size(), kernel);
+      }
+      v_int64 time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+      if(time < 1) {
+        time = 1;
+      }
+      OATPP_LOGD(TAG, "kernel='%s': %.1f MB/s", KERNEL_NAMES[kernel], (double) text.size() * iterations / time);
+    }
+
+  }
+
+}
+
+}}}
@@ -0,0 +1,18 @@
+#ifndef OATPP_SWAGGER_JSONESCAPERTEST_HPP
+#define OATPP_SWAGGER_JSONESCAPERTEST_HPP
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace swagger {
+
+class JsonEscaperTest : public UnitTest {
+public:
+
+  JsonEscaperTest():UnitTest("TEST[swagger::JsonEscaperTest]"){}
+  void onRun() override;
+
+};
+
+}}}
+
+#endif //OATPP_SWAGGER_JSONESCAPERTEST_HPP
@@ -0,0 +1,131 @@
+#include "JsonWriterTest.hpp"
+
+#include "test-controllers/TestController.hpp"
+
+#include "oatpp-swagger/DocumentStream.hpp"
+#include "oatpp-swagger/oas3/Deduplicator.hpp"
+#include "oatpp-swagger/oas3/DocumentFilter.hpp"
+#include "oatpp-swagger/oas3/Generator.hpp"
+#include "oatpp-swagger/oas3/JsonWriter.hpp"
+#include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+#include "oatpp/core/utils/ConversionUtils.hpp"
+
+#include <chrono>
+
+namespace oatpp { namespace test { namespace swagger {
+
+namespace {
+
+  std::shared_ptr<oatpp::swagger::DocumentInfo> createDocumentInfo() {
+
+    oatpp::swagger::DocumentInfo::Builder builder;
+
+    builder
+      .setTitle("JSON \"writer\" test")
+      .setDescription("Escaped text: back\\slash, /path/, tab\t, line\nbreak, control \x01, unicode \xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80")
+      .setVersion("1.0")
+      .addServer("http://localhost:8000", "server on localhost")
+      .addSecurityScheme("basic_auth", oatpp::swagger::DocumentInfo::SecuritySchemeBuilder::DefaultBasicAuthorizationSecurityScheme());
+
+    return builder.build();
+
+  }
+
+  /*
+   * Large document - path items of the source document repeated under different prefixes.
+   */
+  oatpp::swagger::oas3::Document::ObjectWrapper createLargeDocument(const oatpp::swagger::oas3::Document::ObjectWrapper& document, v_int32 copies) {
+    auto result = oatpp::swagger::oas3::Document::createShared();
+    result->info = document->info;
+    result->servers = document->servers;
+    result->components = document->components;
+    result->paths = document->paths->createShared();
+    for(v_int32 i = 0; i < copies; i ++) {
+      auto prefix = "/v" + oatpp::utils::conversion::int32ToStr(i);
+      auto curr = document->paths->getFirstEntry();
+      while(curr != nullptr) {
+        result->paths->put(prefix + curr->getKey(), curr->getValue());
+        curr = curr->getNext();
+      }
+    }
+    return result;
+  }
+
+  v_int64 getMicroseconds(const std::chrono::steady_clock::time_point& start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+  }
+
+}
+
+void JsonWriterTest::onRun() {
+
+  auto serializerConfig = oatpp::parser::json::mapping::Serializer::Config::createShared();
+  serializerConfig->includeNullFields = false;
+  auto objectMapper = oatpp::parser::json::mapping::ObjectMapper::createShared(serializerConfig,
+                                                                               oatpp::parser::json::mapping::Deserializer::Config::createShared());
+
+  auto controller = TestController::createShared(objectMapper);
+  auto endpoints = oatpp::swagger::oas3::Generator::Endpoints::createShared();
+  endpoints->pushBackAll(controller->getEndpoints());
+
+  auto document = oatpp::swagger::oas3::Generator::generateDocument(createDocumentInfo(), endpoints);
+
+  { // Output is identical to the object mapper
+
+    OATPP_ASSERT(oatpp::swagger::oas3::JsonWriter::write(document) == objectMapper->writeToString(document));
+
+    auto liteDocument = oatpp::swagger::oas3::DocumentFilter::createLiteDocument(document);
+    OATPP_ASSERT(oatpp::swagger::oas3::JsonWriter::write(liteDocument) == objectMapper->writeToString(liteDocument));
+
+    auto deduplicated = oatpp::swagger::oas3::Deduplicator::deduplicate(document);
+    OATPP_ASSERT(oatpp::swagger::oas3::JsonWriter::write(deduplicated) == objectMapper->writeToString(deduplicated));
+
+    auto empty = oatpp::swagger::oas3::Document::createShared();
+    OATPP_ASSERT(oatpp::swagger::oas3::JsonWriter::write(empty) == objectMapper->writeToString(empty));
+
+  }
+
+  { // Document parts serialized by the writer
+
+    oatpp::swagger::DocumentStream::Fragments fragments;
+    auto expected = objectMapper->writeToString(document);
+    OATPP_ASSERT(oatpp::swagger::DocumentStream::serialize(objectMapper, document, fragments, true) == expected);
+    OATPP_ASSERT(oatpp::swagger::DocumentStream::serialize(objectMapper, document, fragments, true) == expected);
+
+  }
+
+  { // Throughput against the object mapper
+
+    const v_int32 iterations = 20;
+    auto largeDocument = createLargeDocument(document, 200);
+
+    v_int64 size = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for(v_int32 i = 0; i < iterations; i ++) {
+      size = objectMapper->writeToString(largeDocument)->getSize();
+    }
+    v_int64 mapperTime = getMicroseconds(start);
+
+    start = std::chrono::steady_clock::now();
+    for(v_int32 i = 0; i < iterations; i ++) {
+      OATPP_ASSERT(oatpp::swagger::oas3::JsonWriter::write(largeDocument)->getSize() == size);
+    }
+    v_int64 writerTime = getMicroseconds(start);
+
+    if(mapperTime < 1) {
+      mapperTime = 1;
+    }
+    if(writerTime < 1) {
+      writerTime = 1;
+    }
+
+    OATPP_LOGD(TAG, "document size=%lld bytes, %d iterations", (long long) size, iterations);
+    OATPP_LOGD(TAG, "ObjectMapper: %lld us, %.1f MB/s", (long long) mapperTime, (double) size * iterations / mapperTime);
+    OATPP_LOGD(TAG, "JsonWriter:   %lld us, %.1f MB/s", (long long) writerTime, (double) size * iterations / writerTime);
+
+  }
+
+}
+
+}}}
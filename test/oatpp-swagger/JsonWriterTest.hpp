@@ -0,0 +1,18 @@
+#ifndef OATPP_SWAGGER_JSONWRITERTEST_HPP
+#define OATPP_SWAGGER_JSONWRITERTEST_HPP
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace swagger {
+
+class JsonWriterTest : public UnitTest {
+public:
+
+  JsonWriterTest():UnitTest("TEST[swagger::JsonWriterTest]"){}
+  void onRun() override;
+
+};
+
+}}}
+
+#endif //OATPP_SWAGGER_JSONWRITERTEST_HPP
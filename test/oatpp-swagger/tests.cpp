@@ -2,11 +2,19 @@
 
 #include "./AsyncControllerTest.hpp"
 #include "./ControllerTest.hpp"
+#include "./DeterministicOutputTest.hpp"
+#include "./GeneratorScalingTest.hpp"
+#include "./JsonEscaperTest.hpp"
+#include "./JsonWriterTest.hpp"
 #include <iostream>
 
 void runTests() {
   OATPP_RUN_TEST(oatpp::test::swagger::ControllerTest);
   OATPP_RUN_TEST(oatpp::test::swagger::AsyncControllerTest);
+  OATPP_RUN_TEST(oatpp::test::swagger::DeterministicOutputTest);
+  OATPP_RUN_TEST(oatpp::test::swagger::GeneratorScalingTest);
+  OATPP_RUN_TEST(oatpp::test::swagger::JsonEscaperTest);
+  OATPP_RUN_TEST(oatpp::test::swagger::JsonWriterTest);
 }
 
 int main() {